@@ -739,6 +739,11 @@ struct block_loop {
 	    AV * ary; /* use the stack if this is NULL */
 	    IV ix;
 	} ary;
+	struct { /* valid if type is LOOP_FOR with CXp_FOR_SPLIT */
+	    SV * str; /* pp_split's copy of the string */
+	    STRLEN off; /* start of the next field; past the end when done */
+	    char sep; /* the byte the fields are separated by */
+	} lazysplit;
 	struct { /* valid if type is LOOP_LAZYIV */
 	    IV cur;
 	    IV end;
@@ -791,8 +796,12 @@ struct block_loop {
 	    SvREFCNT_dec_NN(cx->blk_loop.state_u.lazysv.cur);		\
 	    SvREFCNT_dec_NN(cx->blk_loop.state_u.lazysv.end);		\
 	}								\
-	if (CxTYPE(cx) == CXt_LOOP_FOR)					\
-	    SvREFCNT_dec(cx->blk_loop.state_u.ary.ary);
+	if (CxTYPE(cx) == CXt_LOOP_FOR) {				\
+	    if (cx->cx_type & CXp_FOR_SPLIT)				\
+		SvREFCNT_dec_NN(cx->blk_loop.state_u.lazysplit.str);	\
+	    else							\
+		SvREFCNT_dec(cx->blk_loop.state_u.ary.ary);		\
+	}
 
 /* given/when context */
 struct block_givwhen {
@@ -983,6 +992,7 @@ struct context {
 /* private flags for CXt_LOOP */
 #define CXp_FOR_DEF	0x10	/* foreach using $_ */
 #define CXp_FOR_LVREF	0x20	/* foreach using \$var */
+#define CXp_FOR_SPLIT	0x40	/* foreach (split /,/, ...); see pp_iter */
 #define CxPADLOOP(c)	((c)->blk_loop.my_op->op_targ)
 
 /* private flags for CXt_SUBST */
@@ -11,7 +11,7 @@ use Carp ();
 use B ();
 #use Devel::Peek;
 
-$JSON::PP::VERSION = '2.27300';
+$JSON::PP::VERSION = '2.27300_01';
 
 @JSON::PP::EXPORT = qw(encode_json decode_json from_json to_json);
 
@@ -743,6 +743,14 @@ BEGIN {
 
             OUTER: while( defined(next_chr()) ){
 
+                # take a run of plain ASCII characters in one step
+                pos($text) = $at - 1;
+                if($text =~ /\G([\x20\x21\x23-\x26\x28-\x5B\x5D-\x7F]+)/gc){
+                    $s .= $1;
+                    $at = pos($text);
+                    next;
+                }
+
                 if($ch eq $boundChar){
                     next_chr();
 
@@ -837,6 +845,9 @@ BEGIN {
     sub white {
         while( defined $ch  ){
             if($ch le ' '){
+                pos($text) = $at;
+                $text =~ /\G[\x00-\x20]*/g;
+                $at = pos($text);
                 next_chr();
             }
             elsif($ch eq '/'){
@@ -1080,8 +1091,11 @@ BEGIN {
             }
         }
 
-        while(defined $ch and $ch =~ /\d/){
-            $n .= $ch;
+        if(defined $ch and $ch =~ /\d/){
+            pos($text) = $at - 1;
+            $text =~ /\G(\d+)/g;
+            $n .= $1;
+            $at = pos($text);
             next_chr;
         }
 
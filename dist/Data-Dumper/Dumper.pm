@@ -10,7 +10,7 @@
 package Data::Dumper;
 
 BEGIN {
-    $VERSION = '2.156'; # Don't forget to set version and release
+    $VERSION = '2.157'; # Don't forget to set version and release
 }               # date in POD below!
 
 #$| = 1;
@@ -1186,6 +1186,10 @@ Note: If you turn on C<Sparseseen>, then you must not rely on the
 content of the seen hash since its contents will be an
 implementation detail!
 
+When C<Dump> is called as a class method, as C<Dumper> does, the seen
+hash belongs to an object nobody else gets to see, so the XS
+implementation always keeps it sparse.
+
 =back
 
 =head2 Exports
@@ -1419,7 +1423,7 @@ modify it under the same terms as Perl itself.
 
 =head1 VERSION
 
-Version 2.156  (January 20 2014)
+Version 2.157  (October 18 2026)
 
 =head1 SEE ALSO
 
@@ -23,6 +23,7 @@ static bool globname_needs_quote(const char *s, STRLEN len);
 static bool key_needs_quote(const char *s, STRLEN len);
 static bool safe_decimal_number(const char *p, STRLEN len);
 static SV *sv_x (pTHX_ SV *sv, const char *str, STRLEN len, I32 n);
+static char *integer_str(char *end, UV uv, bool neg);
 static I32 DD_dump (pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval,
 		    HV *seenhv, AV *postav, I32 *levelp, I32 indent,
 		    SV *pad, SV *xpad, SV *apad, SV *sep, SV *pair,
@@ -93,6 +94,26 @@ Perl_utf8_to_uvchr_buf(pTHX_ U8 *s, U8 *send, STRLEN *retlen)
 #define DD_is_integer(sv) SvIOK(sv)
 #endif
 
+/* integer_str() for an IV, of which IV_MIN has no positive counterpart */
+#define DD_iv_str(end, iv) \
+	((iv) < 0 ? integer_str(end, (UV) -((iv) + 1) + 1, TRUE) \
+		  : integer_str(end, (UV) (iv), FALSE))
+
+/* Does a scalar without any other reference have weak ones? */
+#ifdef PERL_MAGIC_backref
+#define DD_has_backrefs(sv) (SvTYPE(sv) >= SVt_PVMG && mg_find(sv, PERL_MAGIC_backref))
+#else
+#define DD_has_backrefs(sv) 0
+#endif
+
+/* Can a hash entry's key be used as it is, without an SV for it? */
+#if PERL_VERSION >= 8 && defined(HeKWASUTF8)
+#define DD_HeKPLAIN(he) \
+	(HeKLEN(he) != HEf_SVKEY && !HeKUTF8(he) && !HeKWASUTF8(he))
+#else
+#define DD_HeKPLAIN(he) 0
+#endif
+
 /* does a glob name need to be protected? */
 static bool
 globname_needs_quote(const char *s, STRLEN len)
@@ -403,6 +424,41 @@ sv_x(pTHX_ SV *sv, const char *str, STRLEN len, I32 n)
     return sv;
 }
 
+/* Write uv in decimal (negated if neg) so that it ends at end, as "%"UVuf
+ * would, and return where it starts */
+static char *
+integer_str(char *end, UV uv, bool neg)
+{
+    char *p = end;
+
+    do {
+	*--p = (char) ('0' + uv % 10);
+    } while (uv /= 10);
+    if (neg)
+	*--p = '-';
+    return p;
+}
+
+#if PERL_VERSION >= 8
+/* Compare hash entries by key as sv_cmp() would compare the keys */
+static I32
+sortcmp_he(pTHX_ SV *const a, SV *const b)
+{
+    HE *const ha = (HE *) a;
+    HE *const hb = (HE *) b;
+
+    if (HeKUTF8(ha) == HeKUTF8(hb)) {
+	const STRLEN la = HeKLEN(ha);
+	const STRLEN lb = HeKLEN(hb);
+	const int ret = memcmp(HeKEY(ha), HeKEY(hb), la < lb ? la : lb);
+	if (ret)
+	    return ret < 0 ? -1 : 1;
+	return la < lb ? -1 : la > lb;
+    }
+    return sv_cmp(hv_iterkeysv(ha), hv_iterkeysv(hb));
+}
+#endif
+
 /*
  * This ought to be split into smaller functions. (it is one long function since
  * it exactly parallels the perl version, which was one long thing for
@@ -425,7 +481,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
     char *const id = (char *)&id_buffer;
 #endif
     SV **svp;
-    SV *sv, *ipad, *ival;
+    SV *sv, *ival;
     SV *blesspad = Nullsv;
     AV *seenentry = NULL;
     char *iname;
@@ -607,7 +663,6 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	}
 
 	(*levelp)++;
-	ipad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), *levelp);
 
         if (is_regex) 
         {
@@ -711,7 +766,6 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 	    SSize_t ix = 0;
 	    const SSize_t ixmax = av_len((AV *)ival);
 	
-	    SV * const ixsv = newSViv(0);
 	    /* allowing for a 24 char wide array index */
 	    New(0, iname, namelen+28, char);
 	    (void)strcpy(iname, name);
@@ -743,36 +797,35 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		iname[inamelen++] = '-'; iname[inamelen++] = '>';
 	    }
 	    iname[inamelen++] = '['; iname[inamelen] = '\0';
+
+	    /* The padding of each element: that of the closing bracket
+	     * is the same, less one xpad. */
 	    totpad = newSVsv(sep);
 	    sv_catsv(totpad, pad);
 	    sv_catsv(totpad, apad);
+	    sv_x(aTHX_ totpad, SvPVX_const(xpad), SvCUR(xpad), *levelp);
 
 	    for (ix = 0; ix <= ixmax; ++ix) {
 		STRLEN ilen;
 		SV *elem;
+		char *ixstr;
 		svp = av_fetch((AV*)ival, ix, FALSE);
 		if (svp)
 		    elem = *svp;
 		else
 		    elem = &PL_sv_undef;
 		
-		ilen = inamelen;
-		sv_setiv(ixsv, ix);
-#if PERL_VERSION < 10
-                (void) sprintf(iname+ilen, "%"IVdf, (IV)ix);
-		ilen = strlen(iname);
-#else
-                ilen = ilen + my_sprintf(iname+ilen, "%"IVdf, (IV)ix);
-#endif
+		ixstr = integer_str(tmpbuf + sizeof(tmpbuf), (UV)ix, FALSE);
+		ilen = tmpbuf + sizeof(tmpbuf) - ixstr;
+		Copy(ixstr, iname+inamelen, ilen, char);
+		ilen += inamelen;
 		iname[ilen++] = ']'; iname[ilen] = '\0';
 		if (indent >= 3) {
-		    sv_catsv(retval, totpad);
-		    sv_catsv(retval, ipad);
+		    sv_catpvn(retval, SvPVX_const(totpad), SvCUR(totpad));
 		    sv_catpvs(retval, "#");
-		    sv_catsv(retval, ixsv);
+		    sv_catpvn(retval, iname+inamelen, ilen-inamelen-1);
 		}
-		sv_catsv(retval, totpad);
-		sv_catsv(retval, ipad);
+		sv_catpvn(retval, SvPVX_const(totpad), SvCUR(totpad));
 		DD_dump(aTHX_ elem, iname, ilen, retval, seenhv, postav,
 			levelp,	indent, pad, xpad, apad, sep, pair,
 			freezer, toaster, purity, deepcopy, quotekeys, bless,
@@ -781,28 +834,24 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		if (ix < ixmax)
 		    sv_catpvs(retval, ",");
 	    }
-	    if (ixmax >= 0) {
-		SV * const opad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), (*levelp)-1);
-		sv_catsv(retval, totpad);
-		sv_catsv(retval, opad);
-		SvREFCNT_dec(opad);
-	    }
+	    if (ixmax >= 0)
+		sv_catpvn(retval, SvPVX_const(totpad), SvCUR(totpad) - SvCUR(xpad));
 	    if (name[0] == '@')
 		sv_catpvs(retval, ")");
 	    else
 		sv_catpvs(retval, "]");
-	    SvREFCNT_dec(ixsv);
 	    SvREFCNT_dec(totpad);
 	    Safefree(iname);
 	}
 	else if (realtype == SVt_PVHV) {
 	    SV *totpad, *newapad;
-	    SV *sname;
 	    HE *entry = NULL;
 	    char *key;
 	    I32 klen;
 	    SV *hval;
 	    AV *keys = NULL;
+	    HE **hes = NULL;
+	    SSize_t nhes = 0;
 	
 	    SV * const iname = newSVpvn(name, namelen);
 	    if (name[0] == '%') {
@@ -828,9 +877,16 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		sv_catpvs(iname, "->");
 	    }
 	    sv_catpvs(iname, "{");
+	    inamelen = SvCUR(iname);
+
+	    /* The padding of each pair: that of the closing brace is the
+	     * same, less one xpad. */
 	    totpad = newSVsv(sep);
 	    sv_catsv(totpad, pad);
 	    sv_catsv(totpad, apad);
+	    sv_x(aTHX_ totpad, SvPVX_const(xpad), SvCUR(xpad), *levelp);
+
+	    newapad = indent >= 2 ? newSVsv(apad) : apad;
 	
 	    /* If requested, get a sorted/filtered array of hash keys */
 	    if (sortkeys) {
@@ -838,32 +894,35 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 #if PERL_VERSION < 8
                     sortkeys = sv_2mortal(newSVpvs("Data::Dumper::_sortkeys"));
 #else
-		    keys = newAV();
-		    (void)hv_iterinit((HV*)ival);
-		    while ((entry = hv_iternext((HV*)ival))) {
-			sv = hv_iterkeysv(entry);
-			(void)SvREFCNT_inc(sv);
-			av_push(keys, sv);
-		    }
+		    SVCOMPARE_t cmp = Perl_sv_cmp;
 # ifdef USE_LOCALE_COLLATE
 #       ifdef IN_LC     /* Use this if available */
                     if (IN_LC(LC_COLLATE))
 #       else
                     if (IN_LOCALE)
 #       endif
-                    {
-                        sortsv(AvARRAY(keys),
-			   av_len(keys)+1,
-                           Perl_sv_cmp_locale);
-                    }
-                    else
+                        cmp = Perl_sv_cmp_locale;
 # endif
+		    if (cmp == Perl_sv_cmp && !SvRMAGICAL(ival)) {
+			/* Sort the entries themselves, saving an SV for
+			 * each key and a lookup for each value. */
+			New(0, hes, HvUSEDKEYS((HV*)ival) + 1, HE *);
+			(void)hv_iterinit((HV*)ival);
+			while ((entry = hv_iternext((HV*)ival)))
+			    hes[nhes++] = entry;
+			sortsv((SV **)hes, nhes, sortcmp_he);
+		    }
+		    else {
+			keys = newAV();
+			(void)hv_iterinit((HV*)ival);
+			while ((entry = hv_iternext((HV*)ival))) {
+			    sv = hv_iterkeysv(entry);
+			    (void)SvREFCNT_inc(sv);
+			    av_push(keys, sv);
+			}
+			sortsv(AvARRAY(keys), av_len(keys)+1, cmp);
+		    }
 #endif
-                    {
-                        sortsv(AvARRAY(keys),
-			   av_len(keys)+1,
-                           Perl_sv_cmp);
-                    }
 		}
 		if (sortkeys != &PL_sv_yes) {
 		    dSP; ENTER; SAVETMPS; PUSHMARK(sp);
@@ -888,14 +947,16 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
             /* foreach (keys %hash) */
             for (i = 0; 1; i++) {
 		char *nkey;
-                char *nkey_buffer = NULL;
 		I32 nticks = 0;
-		SV* keysv;
+		SV* keysv = NULL;
 		STRLEN keylen;
                 I32 nlen;
 		bool do_utf8 = FALSE;
 
-               if (sortkeys) {
+               if (hes) {
+                   if ((SSize_t)i >= nhes) break;
+                   entry = hes[i];
+               } else if (sortkeys) {
                    if (!(keys && (SSize_t)i <= av_len(keys))) break;
                } else {
                    if (!(entry = hv_iternext((HV *)ival))) break;
@@ -904,7 +965,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		if (i)
 		    sv_catpvs(retval, ",");
 
-		if (sortkeys) {
+		if (sortkeys && !hes) {
 		    char *key;
 		    svp = av_fetch(keys, i, FALSE);
 		    keysv = svp ? *svp : sv_newmortal();
@@ -914,16 +975,22 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		    hval = svp ? *svp : sv_newmortal();
 		}
 		else {
-		    keysv = hv_iterkeysv(entry);
+		    if (!DD_HeKPLAIN(entry))
+			keysv = hv_iterkeysv(entry);
 		    hval = hv_iterval((HV*)ival, entry);
 		}
 
-		key = SvPV(keysv, keylen);
-		do_utf8 = DO_UTF8(keysv);
+		if (keysv) {
+		    key = SvPV(keysv, keylen);
+		    do_utf8 = DO_UTF8(keysv);
+		}
+		else {
+		    key = HeKEY(entry);	/* Plain bytes: no need for an SV */
+		    keylen = HeKLEN(entry);
+		}
 		klen = keylen;
 
-                sv_catsv(retval, totpad);
-                sv_catsv(retval, ipad);
+                sv_catpvn(retval, SvPVX_const(totpad), SvCUR(totpad));
                 /* The (very)
                    old logic was first to check utf8 flag, and if utf8 always
                    call esc_q_utf8.  This caused test to break under -Mutf8,
@@ -948,9 +1015,10 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                         nkey = SvPVX(retval) + ocur;
                     }
                     else {
+                        /* Quote straight into the output */
+                        const STRLEN ocur = SvCUR(retval);
 		        nticks = num_q(key, klen);
-			New(0, nkey_buffer, klen+nticks+3, char);
-                        nkey = nkey_buffer;
+			nkey = SvGROW(retval, ocur+klen+nticks+3) + ocur;
 			nkey[0] = '\'';
 			if (nticks)
 			    klen += esc_q(nkey+1, key, klen);
@@ -959,7 +1027,7 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 			nkey[++klen] = '\'';
 			nkey[++klen] = '\0';
                         nlen = klen;
-                        sv_catpvn(retval, nkey, klen);
+                        SvCUR_set(retval, ocur+klen);
 		    }
                 }
                 else {
@@ -967,45 +1035,31 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
                     nlen = klen;
                     sv_catpvn(retval, nkey, klen);
 		}
-                sname = newSVsv(iname);
-                sv_catpvn(sname, nkey, nlen);
-                sv_catpvs(sname, "}");
+                SvCUR_set(iname, inamelen);
+                sv_catpvn(iname, nkey, nlen);
+                sv_catpvs(iname, "}");
 
 		sv_catsv(retval, pair);
 		if (indent >= 2) {
-		    char *extra;
-		    I32 elen = 0;
-		    newapad = newSVsv(apad);
-		    New(0, extra, klen+4+1, char);
-		    while (elen < (klen+4))
-			extra[elen++] = ' ';
-		    extra[elen] = '\0';
-		    sv_catpvn(newapad, extra, elen);
-		    Safefree(extra);
+		    SvCUR_set(newapad, SvCUR(apad));
+		    sv_x(aTHX_ newapad, " ", 1, klen+4);
 		}
-		else
-		    newapad = apad;
 
-		DD_dump(aTHX_ hval, SvPVX_const(sname), SvCUR(sname), retval, seenhv,
+		DD_dump(aTHX_ hval, SvPVX_const(iname), SvCUR(iname), retval, seenhv,
 			postav, levelp,	indent, pad, xpad, newapad, sep, pair,
 			freezer, toaster, purity, deepcopy, quotekeys, bless,
 			maxdepth, sortkeys, use_sparse_seen_hash, useqq,
 			maxrecurse);
-		SvREFCNT_dec(sname);
-		Safefree(nkey_buffer);
-		if (indent >= 2)
-		    SvREFCNT_dec(newapad);
-	    }
-	    if (i) {
-		SV *opad = sv_x(aTHX_ Nullsv, SvPVX_const(xpad), SvCUR(xpad), *levelp-1);
-		sv_catsv(retval, totpad);
-		sv_catsv(retval, opad);
-		SvREFCNT_dec(opad);
 	    }
+	    if (i)
+		sv_catpvn(retval, SvPVX_const(totpad), SvCUR(totpad) - SvCUR(xpad));
 	    if (name[0] == '%')
 		sv_catpvs(retval, ")");
 	    else
 		sv_catpvs(retval, "}");
+	    if (indent >= 2)
+		SvREFCNT_dec(newapad);
+	    Safefree(hes);
 	    SvREFCNT_dec(iname);
 	    SvREFCNT_dec(totpad);
 	}
@@ -1052,7 +1106,6 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 		sv_catpvs(retval, "()");
 	    }
 	}
-	SvREFCNT_dec(ipad);
 	(*levelp)--;
     }
     else {
@@ -1085,11 +1138,16 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
              * after the dump, then only store in seen hash if the SV
              * ref count is larger than 1. If it's 1, then we know that
              * there is no other reference, duh. This is an optimization.
-             * Note that we'd have to check for weak-refs, too, but this is
-             * already the branch for non-refs only. */
-	    else if (val != &PL_sv_undef && (!use_sparse_seen_hash || SvREFCNT(val) > 1)) {
-		SV * const namesv = newSVpvs("\\");
-		sv_catpvn(namesv, name, namelen);
+             * Weak references don't count, so look for those as well. */
+	    else if (val != &PL_sv_undef
+		     && (!use_sparse_seen_hash || SvREFCNT(val) > 1
+			 || DD_has_backrefs(val))) {
+		SV * const namesv = newSV(namelen+1);
+		(SvPVX(namesv))[0] = '\\';
+		Copy(name, SvPVX(namesv)+1, namelen, char);
+		SvCUR_set(namesv, namelen+1);
+		*SvEND(namesv) = '\0';
+		SvPOK_only(namesv);
 		seenentry = newAV();
 		av_push(seenentry, namesv);
 		av_push(seenentry, newRV_inc(val));
@@ -1100,25 +1158,30 @@ DD_dump(pTHX_ SV *val, const char *name, STRLEN namelen, SV *retval, HV *seenhv,
 
         if (DD_is_integer(val)) {
             STRLEN len;
+            /* Leave room for the quotes below */
+            char * const end = tmpbuf + sizeof(tmpbuf) - 1;
 	    if (SvIsUV(val))
-	      len = my_snprintf(tmpbuf, sizeof(tmpbuf), "%"UVuf, SvUV(val));
+	      c = integer_str(end, SvUV(val), FALSE);
 	    else
-	      len = my_snprintf(tmpbuf, sizeof(tmpbuf), "%"IVdf, SvIV(val));
+	      c = DD_iv_str(end, SvIV(val));
+            len = end - c;
             if (SvPOK(val)) {
               /* Need to check to see if this is a string such as " 0".
                  I'm assuming from sprintf isn't going to clash with utf8.
                  Is this valid on EBCDIC?  */
               STRLEN pvlen;
               const char * const pv = SvPV(val, pvlen);
-              if (pvlen != len || memNE(pv, tmpbuf, len))
+              if (pvlen != len || memNE(pv, c, len))
                 goto integer_came_from_string;
             }
             if (len > 10) {
               /* Looks like we're on a 64 bit system.  Make it a string so that
                  if a 32 bit system reads the number it will cope better.  */
-              sv_catpvf(retval, "'%s'", tmpbuf);
-            } else
-              sv_catpvn(retval, tmpbuf, len);
+              *--c = '\'';
+              *end = '\'';
+              len += 2;
+            }
+            sv_catpvn(retval, c, len);
 	}
 	else if (realtype == SVt_PVGV) {/* GLOBs can end up with scribbly names */
 	    c = SvPV(val, i);
@@ -1294,8 +1357,11 @@ Data_Dumper_Dumpxs(href, ...)
 	    char tmpbuf[1024];
 	    I32 gimme = GIMME_V;
             int use_sparse_seen_hash = 0;
+            bool private_seen = FALSE;
 
 	    if (!SvROK(href)) {		/* call new to get an object first */
+		/* Nobody else gets to see the object, hence its seen hash */
+		private_seen = TRUE;
 		if (items < 2)
 		    croak("Usage: Data::Dumper::Dumpxs(PACKAGE, VAL_ARY_REF, [NAME_ARY_REF])");
 		
@@ -1341,6 +1407,8 @@ Data_Dumper_Dumpxs(href, ...)
                     use_sparse_seen_hash = 1;
 		if ((svp = hv_fetch(hv, "noseen", 6, FALSE)))
 		    use_sparse_seen_hash = (SvOK(*svp) && SvIV(*svp) != 0);
+		if (private_seen)
+		    use_sparse_seen_hash = 1;
 		if ((svp = hv_fetch(hv, "todump", 6, FALSE)) && SvROK(*svp))
 		    todumpav = (AV*)SvRV(*svp);
 		if ((svp = hv_fetch(hv, "names", 5, FALSE)) && SvROK(*svp))
@@ -15,13 +15,13 @@ BEGIN {
 use strict;
 
 use Data::Dumper;
-use Test::More tests => 26;
+use Test::More tests => 28;
 use lib qw( ./t/lib );
 use Testing qw( _dumptostr );
 
 run_tests_for_sortkeys();
 SKIP: {
-    skip "XS version was unavailable, so we already ran with pure Perl", 13 
+    skip "XS version was unavailable, so we already ran with pure Perl", 14 
         if $Data::Dumper::Useperl;
     local $Data::Dumper::Useperl = 1;
     run_tests_for_sortkeys();
@@ -176,6 +176,22 @@ sub run_tests_for_sortkeys {
             "Got expected warning: sorting routine did not return array ref");
     }
 
+    {
+        my %mixed = map { $_ => 1 } "b", "a", "ab", "A", "\x{e9}", "\x{ff}",
+            "\x{100}", "\x{263a}", "\x{e9}z", "";
+        my $upgraded = "\x{e8}";
+        utf8::upgrade($upgraded);
+        $mixed{$upgraded} = 1;
+        my @order = sort keys %mixed;
+
+        local $Data::Dumper::Sortkeys = 1;
+        local $Data::Dumper::Indent = 0;
+        local $Data::Dumper::Terse = 1;
+        local $Data::Dumper::Useqq = 1;
+        is(Dumper(\%mixed),
+           '{' . join(',', map { Data::Dumper::qquote($_) . ' => 1' } @order) . '}',
+           "Sortkeys = 1 sorts byte and utf8 keys together as sort does");
+    }
 }
 
 sub reversekeys { return [ reverse sort keys %{+shift} ]; }
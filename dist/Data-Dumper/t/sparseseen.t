@@ -15,7 +15,8 @@ BEGIN {
 use strict;
 
 use Data::Dumper;
-use Test::More tests =>  8;
+use Scalar::Util ();
+use Test::More tests => 12;
 use lib qw( ./t/lib );
 use Testing qw( _dumptostr );
 
@@ -28,7 +29,7 @@ my %d = (
 
 run_tests_for_sparseseen();
 SKIP: {
-    skip "XS version was unavailable, so we already ran with pure Perl", 4
+    skip "XS version was unavailable, so we already ran with pure Perl", 6
         if $Data::Dumper::Useperl;
     local $Data::Dumper::Useperl = 1;
     run_tests_for_sparseseen();
@@ -84,5 +85,23 @@ sub run_tests_for_sparseseen {
     is($dumps{'ddsszero'}, $dumps{'objssundef'},
         "\$Data::Dumper::Sparseseen = undef and = 0 are equivalent");
     %dumps = ();
+
+    # Scalars referenced from elsewhere are found however sparse the
+    # seen hash, including through weak references
+    my @a = (1, 2, 3);
+    my @shared = (\$a[0], \$a[1]);
+    my $weak = [ \$a[2] ];
+    Scalar::Util::weaken($weak->[0]);
+    my @vals = (\@a, @shared, $weak);
+    $obj = Data::Dumper->new( [ @vals ] );
+    $obj->Sparseseen(1);
+    $dumps{'sparse'} = _dumptostr($obj);
+    $obj = Data::Dumper->new( [ @vals ] );
+    $obj->Sparseseen(0);
+    $dumps{'full'} = _dumptostr($obj);
+    is($dumps{'sparse'}, $dumps{'full'},
+        "Sparseseen(1) finds scalars with other or weak references");
+    is(Dumper(@vals), $dumps{'full'},
+        "Dumper() finds scalars with other or weak references");
 }
 
@@ -17,12 +17,13 @@ package Storable; @ISA = qw(Exporter);
 	dclone
 	retrieve_fd
 	lock_store lock_nstore lock_retrieve
+	retrieve_each fd_retrieve_each
         file_magic read_magic
 );
 
 use vars qw($canonical $forgive_me $VERSION);
 
-$VERSION = '2.52';
+$VERSION = '2.53';
 
 BEGIN {
     if (eval { local $SIG{__DIE__}; require Log::Agent; 1 }) {
@@ -406,6 +407,46 @@ sub fd_retrieve {
 
 sub retrieve_fd { &fd_retrieve }		# Backward compatibility
 
+#
+# retrieve_each
+#
+# Same as retrieve, but instead of returning the root array or hash, hand
+# its elements to the supplied callback one at a time.  Returns how many
+# elements were seen.
+#
+sub retrieve_each {
+	my ($file, $code) = @_;
+	logcroak "not a CODE reference" unless ref $code eq 'CODE';
+	local *FILE;
+	open(FILE, $file) || logcroak "can't open $file: $!";
+	binmode FILE;							# Archaic systems...
+	my $count;
+	my $da = $@;							# Could be from exception handler
+	eval { $count = pretrieve_each(*FILE, $code) };	# Call C routine
+	close(FILE);
+	logcroak $@ if $@ =~ s/\.?\n$/,/;
+	$@ = $da;
+	return $count;
+}
+
+#
+# fd_retrieve_each
+#
+# Same as retrieve_each, but from an already opened file descriptor.
+#
+sub fd_retrieve_each {
+	my ($file, $code) = @_;
+	my $fd = fileno($file);
+	logcroak "not a valid file descriptor" unless defined $fd;
+	logcroak "not a CODE reference" unless ref $code eq 'CODE';
+	my $count;
+	my $da = $@;							# Could be from exception handler
+	eval { $count = pretrieve_each($file, $code) };	# Call C routine
+	logcroak $@ if $@ =~ s/\.?\n$/,/;
+	$@ = $da;
+	return $count;
+}
+
 #
 # thaw
 #
@@ -537,6 +578,34 @@ Storable provides you with a C<dclone> interface which does not create
 that intermediary scalar but instead freezes the structure in some
 internal memory space and then immediately thaws it out.
 
+=head1 RETRIEVING ONE ELEMENT AT A TIME
+
+Retrieving a large image recreates the whole structure in memory before
+you get to look at any of it.  When the root of that structure is an
+array or a hash whose elements can be dealt with independently, you may
+instead use C<retrieve_each> (or C<fd_retrieve_each> on an already opened
+file descriptor), which reads the image as it goes and hands the elements
+over to a callback, one at a time:
+
+    use Storable qw(retrieve_each);
+
+    retrieve_each('file', sub {
+        my ($key, $value) = @_;		# index and element for an array
+        ...
+    });
+
+The root container itself is never built, and each element is released
+once the callback returns (unless the callback kept a reference to it),
+so memory use stays bounded by the size of the largest element.  The
+routines return the number of elements handed over, or C<undef> if an
+I/O error occurred.  An exception raised by the callback stops the
+iteration and is propagated.
+
+This only works for images whose root is a plain, unblessed array or
+hash, and whose elements do not share anything with one another: a
+reference from an element to data held by a previous one cannot be
+honoured, since that data is gone, and causes an exception.
+
 =head1 ADVISORY LOCKING
 
 The C<lock_store> and C<lock_nstore> routine are equivalent to
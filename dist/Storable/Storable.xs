@@ -50,6 +50,17 @@
  * Earlier versions of perl might be used, we can't assume they have the latest!
  */
 
+/*
+ * Big enough files are read into memory in one go and retrieved from
+ * there, the way thaw() works on a string, rather than read through
+ * PerlIO a few bytes at a time.
+ */
+#ifdef PERLIO_LAYERS
+#include "perliol.h"
+#define USE_SLURP_RETRIEVE
+#define SLURP_MIN	(1 << 16)	/* don't bother reading smaller files */
+#endif
+
 #ifndef HvSHAREKEYS_off
 #define HvSHAREKEYS_off(hv)	/* Ignore */
 #endif
@@ -309,6 +320,7 @@ typedef struct stcxt {
 	HV *hseen;			
 	AV *hook_seen;		/* which SVs were returned by STORABLE_freeze() */
 	AV *aseen;			/* which objects have been seen, retrieve time */
+	IV aseen_base;		/* tag number of aseen[0], retrieve time */
 	IV where_is_undef;		/* index in aseen of PL_sv_undef */
 	HV *hclass;			/* which classnames have been seen, store time */
 	AV *aclass;			/* which classnames have been seen, retrieve time */
@@ -587,10 +599,14 @@ static stcxt_t *Context_ptr = NULL;
 	mend = mbase + msiz;				\
   } STMT_END
 
+/*
+ * Grow by at least half again, so that building a big image takes a
+ * handful of reallocations rather than one every MGROW bytes.
+ */
 #define MBUF_XTEND(x) 				\
   STMT_START {						\
-	int nsz = (int) round_mgrow((x)+msiz);	\
-	int offset = mptr - mbase;		\
+	STRLEN nsz = (STRLEN) round_mgrow((x)+msiz+(msiz>>1));	\
+	STRLEN offset = mptr - mbase;		\
 	ASSERT(!cxt->membuf_ro, ("mbase is not read-only")); \
 	TRACEME(("** extending mbase from %d to %d bytes (wants %d new)", \
 		msiz, nsz, (x)));			\
@@ -1043,12 +1059,21 @@ static const char byteorderstr_56[] = {BYTEORDER_BYTES_56, 0};
  */
 #define SEEN0_NN(y,i)						        \
     STMT_START {							\
-	if (av_store(cxt->aseen, cxt->tagnum++, i ? (SV*)(y) : SvREFCNT_inc(y)) == 0) \
+	if (av_store(cxt->aseen, cxt->tagnum++ - cxt->aseen_base,	\
+			i ? (SV*)(y) : SvREFCNT_inc(y)) == 0)		\
 		return (SV *) 0;					\
 	TRACEME(("aseen(#%d) = 0x%"UVxf" (refcnt=%d)", cxt->tagnum-1,   \
 		 PTR2UV(y), SvREFCNT(y)-1));		                \
     } STMT_END
 
+/*
+ * Fetch the object retrieved under a given tag number.  Tags below
+ * aseen_base belong to objects already released by retrieve_each().
+ */
+#define SEEN_FETCH(tag)						        \
+	((IV) (tag) < cxt->aseen_base ? (SV **) 0 :			\
+		av_fetch(cxt->aseen, (tag) - cxt->aseen_base, FALSE))
+
 #define SEEN0(y,i)						        \
     STMT_START {							\
 	if (!y)								\
@@ -1091,7 +1116,8 @@ static const char byteorderstr_56[] = {BYTEORDER_BYTES_56, 0};
   } STMT_END
 /*
  * sort (used in store_hash) - conditionally use qsort when
- * sortsv is not available ( <= 5.6.1 ).
+ * sortsv is not available ( <= 5.6.1 ).  What is sorted is an array of
+ * the hash's entries, see sortcmp_he().
  */
 
 #if (PATCHLEVEL <= 6)
@@ -1103,20 +1129,20 @@ static const char byteorderstr_56[] = {BYTEORDER_BYTES_56, 0};
         PerlInterpreter *orig_perl = PERL_GET_CONTEXT; \
         SAVESPTR(orig_perl); \
         PERL_SET_CONTEXT(aTHX); \
-        qsort((char *) AvARRAY(av), len, sizeof(SV *), sortcmp); \
+        qsort((char *) ary, len, sizeof(HE *), sortcmp); \
         } LEAVE;
 
 #else /* ! USE_ITHREADS */
 
 #define STORE_HASH_SORT \
-        qsort((char *) AvARRAY(av), len, sizeof(SV *), sortcmp);
+        qsort((char *) ary, len, sizeof(HE *), sortcmp);
 
 #endif  /* USE_ITHREADS */
 
 #else /* PATCHLEVEL > 6 */
 
 #define STORE_HASH_SORT \
-        sortsv(AvARRAY(av), len, Perl_sv_cmp);  
+        sortsv((SV **) ary, len, sortcmp_he);
 
 #endif /* PATCHLEVEL <= 6 */
 
@@ -1533,6 +1559,7 @@ static void init_retrieve_context(pTHX_ stcxt_t *cxt, int optype, int is_tainted
 		      ? newHV() : 0);
 
 	cxt->aseen = newAV();			/* Where retrieved objects are kept */
+	cxt->aseen_base = 0;
 	cxt->where_is_undef = -1;		/* Special case for PL_sv_undef */
 	cxt->aclass = newAV();			/* Where seen classnames are kept */
 	cxt->tagnum = 0;				/* Have to count objects... */
@@ -1567,6 +1594,7 @@ static void clean_retrieve_context(pTHX_ stcxt_t *cxt)
 		av_undef(aseen);
 		sv_free((SV *) aseen);
 	}
+	cxt->aseen_base = 0;
 	cxt->where_is_undef = -1;
 
 	if (cxt->aclass) {
@@ -2314,13 +2342,54 @@ static int store_array(pTHX_ stcxt_t *cxt, AV *av)
 }
 
 
+/*
+ * sortcmp_he
+ *
+ * Compare the keys of two hash entries, passed as SVs for sortsv(), in
+ * the order sv_cmp() would put them.  Keys of the same kind, both bytes
+ * or both UTF-8, compare as plain bytes, UTF-8 sorting by code point, so
+ * only mixed pairs (and SV keys) need SVs made to be compared.
+ */
+static I32
+sortcmp_he(pTHX_ SV *a, SV *b)
+{
+	HE *ha = (HE *) a;
+	HE *hb = (HE *) b;
+	I32 la = HeKLEN(ha);
+	I32 lb = HeKLEN(hb);
+	int cmp;
+
+	if (la == HEf_SVKEY || lb == HEf_SVKEY
+#ifdef HAS_UTF8_HASHES
+	    || !HeKUTF8(ha) != !HeKUTF8(hb)
+#endif
+	   )
+		return sv_cmp(hv_iterkeysv(ha), hv_iterkeysv(hb));
+
+	cmp = memcmp(HeKEY(ha), HeKEY(hb), la < lb ? la : lb);
+	if (cmp)
+		return cmp < 0 ? -1 : 1;
+	return la < lb ? -1 : la > lb;
+}
+
+/*
+ * A hash entry's key and value, copied out of the entry by store_hash()
+ * in canonical mode.
+ */
+typedef struct {
+	SV *val;		/* value, mortal reference held */
+	char *key;		/* key bytes, in the key buffer */
+	STRLEN klen;
+	bool utf8;		/* key is in UTF-8 */
+	bool wasutf8;		/* key is bytes, but was given in UTF-8 */
+} hent_copy;
+
 #if (PATCHLEVEL <= 6)
 
 /*
  * sortcmp
  *
- * Sort two SVs
- * Borrowed from perl source file pp_ctl.c, where it is used by pp_sort.
+ * Sort two hash entries by key, for qsort().
  */
 static int
 sortcmp(const void *a, const void *b)
@@ -2328,11 +2397,220 @@ sortcmp(const void *a, const void *b)
 #if defined(USE_ITHREADS)
         dTHX;
 #endif /* USE_ITHREADS */
-        return sv_cmp(*(SV * const *) a, *(SV * const *) b);
+        return sortcmp_he(aTHX_ *(SV * const *) a, *(SV * const *) b);
 }
 
 #endif /* PATCHLEVEL <= 6 */
 
+/*
+ * store_hash_sorted
+ *
+ * Store the len entries of hv, which is being iterated over, in canonical
+ * order, for store_hash().  What it allocates is freed when the caller
+ * leaves its scope.
+ */
+static int store_hash_sorted(
+	pTHX_
+	stcxt_t *cxt,
+	HV *hv,
+	I32 len,
+	unsigned char hash_flags,
+	int flagged_hash)
+{
+	I32 i;
+	int ret;
+
+	/*
+	 * Storing in order, sorted by key.
+	 * Run through the hash, building up an array of its entries,
+	 * sort that by key, then copy out the keys and values before
+	 * storing any of them: a STORABLE_freeze hook could change the
+	 * hash, freeing the entries.
+	 */
+
+	HE **ary;
+	hent_copy *ents;
+	char *keycopy;
+	STRLEN ksize = 0;
+#ifdef HAS_RESTRICTED_HASHES
+	int placeholders = (int)HvPLACEHOLDERS_get(hv);
+#endif
+
+	TRACEME(("using canonical order"));
+
+	New(10003, ary, len, HE *);
+	SAVEFREEPV(ary);
+	for (i = 0; i < len; i++) {
+#ifdef HAS_RESTRICTED_HASHES
+		HE *he = hv_iternext_flags(hv, HV_ITERNEXT_WANTPLACEHOLDERS);
+#else
+		HE *he = hv_iternext(hv);
+#endif
+		if (!he)
+			CROAK(("Hash %p inconsistent - expected %d keys, %dth is NULL", hv, (int)len, (int)i));
+		ary[i] = he;
+	}
+
+	STORE_HASH_SORT;
+
+	/*
+	 * Copy all the keys into one buffer, which is cheaper than
+	 * making an SV for each.
+	 */
+
+	New(10003, ents, len, hent_copy);
+	SAVEFREEPV(ents);
+	for (i = 0; i < len; i++) {
+		HE *he = ary[i];
+		hent_copy *ent = &ents[i];
+		SV *val = hv_iterval(hv, he);
+
+		ent->val = (!val || SvIMMORTAL(val))
+			? val : sv_2mortal(SvREFCNT_inc(val));
+		if (HeKLEN(he) == HEf_SVKEY) {
+			SV *key = HeKEY_sv(he);
+			ent->key = SvPV(key, ent->klen);
+			ent->utf8 = SvUTF8(key) ? TRUE : FALSE;
+			ent->wasutf8 = FALSE;
+		} else {
+			ent->key = HeKEY(he);
+			ent->klen = HeKLEN(he);
+#ifdef HAS_HASH_KEY_FLAGS
+			ent->utf8 = HeKUTF8(he) ? TRUE : FALSE;
+			ent->wasutf8 = HeKWASUTF8(he) ? TRUE : FALSE;
+#else
+			ent->utf8 = ent->wasutf8 = FALSE;
+#endif
+		}
+		ksize += ent->klen;
+	}
+	New(10003, keycopy, ksize + 1, char);
+	SAVEFREEPV(keycopy);
+	for (i = 0; i < len; i++) {
+		hent_copy *ent = &ents[i];
+		Copy(ent->key, keycopy, ent->klen, char);
+		ent->key = keycopy;
+		keycopy += ent->klen;
+	}
+
+	for (i = 0; i < len; i++) {
+                unsigned char flags = 0;
+		char *keyval;
+		STRLEN keylen_tmp;
+                I32 keylen;
+		hent_copy *ent = &ents[i];
+		SV *val = ent->val;
+
+		if (!val) {
+			/* Internal error, not I/O error */
+			return 1;
+		}
+		if (val == &PL_sv_placeholder) {
+#ifdef HAS_RESTRICTED_HASHES
+			/* Track how many placeholders we have, and
+			   error if we "see" too many.  */
+			if (--placeholders < 0) {
+				/* This should not happen - number of
+				   retrieves should be identical to
+				   number of placeholders.  */
+		  		return 1;
+			}
+			/* Value is never needed, and PL_sv_undef is
+			   more space efficient to store.  */
+			val = &PL_sv_undef;
+			ASSERT (flags == 0,
+				("Flags not 0 but %d", flags));
+			flags = SHV_K_PLACEHOLDER;
+#else
+			return 1;
+#endif
+		}
+		
+		/*
+		 * Store value first.
+		 */
+		
+		TRACEME(("(#%d) value 0x%"UVxf, i, PTR2UV(val)));
+
+		if ((ret = store(aTHX_ cxt, val)))	/* Extra () for -Wall, grr... */
+			return ret;
+
+		/*
+		 * Write key string.
+		 * Keys are written after values to make sure retrieval
+		 * can be optimal in terms of memory usage, where keys are
+		 * read into a fixed unique buffer called kbuf.
+		 * See retrieve_hash() for details.
+		 */
+		 
+                /* Implementation of restricted hashes isn't nicely
+                   abstracted:  */
+		if ((hash_flags & SHV_RESTRICTED)
+		 && SvTRULYREADONLY(val)) {
+			flags |= SHV_K_LOCKED;
+		}
+
+		keyval = ent->key;
+		keylen_tmp = ent->klen;
+		/* Stored as bytes, but was UTF-8 */
+		if (ent->wasutf8)
+			flags |= SHV_K_WASUTF8;
+                keylen = keylen_tmp;
+#ifdef HAS_UTF8_HASHES
+                /* If you build without optimisation on pre 5.6
+                   then nothing spots that ent->utf8 is always 0,
+                   so the block isn't optimised away, at which point
+                   the linker dislikes the reference to
+                   bytes_from_utf8.  */
+		if (ent->utf8) {
+                    const char *keysave = keyval;
+                    bool is_utf8 = TRUE;
+
+                    /* Just casting the &klen to (STRLEN) won't work
+                       well if STRLEN and I32 are of different widths.
+                       --jhi */
+                    keyval = (char*)bytes_from_utf8((U8*)keyval,
+                                                    &keylen_tmp,
+                                                    &is_utf8);
+
+                    /* If we were able to downgrade here, then than
+                       means that we have  a key which only had chars
+                       0-255, but was utf8 encoded.  */
+
+                    if (keyval != keysave) {
+                        keylen = keylen_tmp;
+                        flags |= SHV_K_WASUTF8;
+                    } else {
+                        /* keylen_tmp can't have changed, so no need
+                           to assign back to keylen.  */
+                        flags |= SHV_K_UTF8;
+                    }
+                }
+#endif
+
+                if (flagged_hash) {
+                    PUTMARK(flags);
+                    TRACEME(("(#%d) key '%s' flags %x %u", i, keyval, flags, *keyval));
+                } else {
+                    /* This is a workaround for a bug in 5.8.0
+                       that causes the HEK_WASUTF8 flag to be
+                       set on an HEK without the hash being
+                       marked as having key flags. We just
+                       cross our fingers and drop the flag.
+                       AMS 20030901 */
+                    assert (flags == 0 || flags == SHV_K_WASUTF8);
+                    TRACEME(("(#%d) key '%s'", i, keyval));
+                }
+		WLEN(keylen);
+		if (keylen)
+			WRITE(keyval, keylen);
+		if (ent->utf8 && (flags & SHV_K_WASUTF8))
+			Safefree (keyval);
+	}
+
+	return 0;
+}
+
 /*
  * store_hash
  *
@@ -2416,158 +2694,18 @@ static int store_hash(pTHX_ stcxt_t *cxt, HV *hv)
 			(SvTRUE(perl_get_sv("Storable::canonical", GV_ADD)) ? 1 : 0))))
 	) {
 		/*
-		 * Storing in order, sorted by key.
-		 * Run through the hash, building up an array of keys in a
-		 * mortal array, sort the array and then run through the
-		 * array.  
+		 * The sorted copies, and the references held on the values,
+		 * are released on leaving the scope: for each hash rather
+		 * than at the end of the whole store, and when a hook croaks.
 		 */
 
-		AV *av = newAV();
-
-                /*av_extend (av, len);*/
-
-		TRACEME(("using canonical order"));
-
-		for (i = 0; i < len; i++) {
-#ifdef HAS_RESTRICTED_HASHES
-			HE *he = hv_iternext_flags(hv, HV_ITERNEXT_WANTPLACEHOLDERS);
-#else
-			HE *he = hv_iternext(hv);
-#endif
-			SV *key;
-
-			if (!he)
-				CROAK(("Hash %p inconsistent - expected %d keys, %dth is NULL", hv, (int)len, (int)i));
-			key = hv_iterkeysv(he);
-			av_store(av, AvFILLp(av)+1, key);	/* av_push(), really */
-		}
-			
-		STORE_HASH_SORT;
-
-		for (i = 0; i < len; i++) {
-#ifdef HAS_RESTRICTED_HASHES
-			int placeholders = (int)HvPLACEHOLDERS_get(hv);
-#endif
-                        unsigned char flags = 0;
-			char *keyval;
-			STRLEN keylen_tmp;
-                        I32 keylen;
-			SV *key = av_shift(av);
-			/* This will fail if key is a placeholder.
-			   Track how many placeholders we have, and error if we
-			   "see" too many.  */
-			HE *he  = hv_fetch_ent(hv, key, 0, 0);
-			SV *val;
-
-			if (he) {
-				if (!(val =  HeVAL(he))) {
-					/* Internal error, not I/O error */
-					return 1;
-				}
-			} else {
-#ifdef HAS_RESTRICTED_HASHES
-				/* Should be a placeholder.  */
-				if (placeholders-- < 0) {
-					/* This should not happen - number of
-					   retrieves should be identical to
-					   number of placeholders.  */
-			  		return 1;
-				}
-				/* Value is never needed, and PL_sv_undef is
-				   more space efficient to store.  */
-				val = &PL_sv_undef;
-				ASSERT (flags == 0,
-					("Flags not 0 but %d", flags));
-				flags = SHV_K_PLACEHOLDER;
-#else
-				return 1;
-#endif
-			}
-			
-			/*
-			 * Store value first.
-			 */
-			
-			TRACEME(("(#%d) value 0x%"UVxf, i, PTR2UV(val)));
-
-			if ((ret = store(aTHX_ cxt, val)))	/* Extra () for -Wall, grr... */
-				goto out;
-
-			/*
-			 * Write key string.
-			 * Keys are written after values to make sure retrieval
-			 * can be optimal in terms of memory usage, where keys are
-			 * read into a fixed unique buffer called kbuf.
-			 * See retrieve_hash() for details.
-			 */
-			 
-                        /* Implementation of restricted hashes isn't nicely
-                           abstracted:  */
-			if ((hash_flags & SHV_RESTRICTED)
-			 && SvTRULYREADONLY(val)) {
-				flags |= SHV_K_LOCKED;
-			}
-
-			keyval = SvPV(key, keylen_tmp);
-                        keylen = keylen_tmp;
-#ifdef HAS_UTF8_HASHES
-                        /* If you build without optimisation on pre 5.6
-                           then nothing spots that SvUTF8(key) is always 0,
-                           so the block isn't optimised away, at which point
-                           the linker dislikes the reference to
-                           bytes_from_utf8.  */
-			if (SvUTF8(key)) {
-                            const char *keysave = keyval;
-                            bool is_utf8 = TRUE;
-
-                            /* Just casting the &klen to (STRLEN) won't work
-                               well if STRLEN and I32 are of different widths.
-                               --jhi */
-                            keyval = (char*)bytes_from_utf8((U8*)keyval,
-                                                            &keylen_tmp,
-                                                            &is_utf8);
-
-                            /* If we were able to downgrade here, then than
-                               means that we have  a key which only had chars
-                               0-255, but was utf8 encoded.  */
-
-                            if (keyval != keysave) {
-                                keylen = keylen_tmp;
-                                flags |= SHV_K_WASUTF8;
-                            } else {
-                                /* keylen_tmp can't have changed, so no need
-                                   to assign back to keylen.  */
-                                flags |= SHV_K_UTF8;
-                            }
-                        }
-#endif
-
-                        if (flagged_hash) {
-                            PUTMARK(flags);
-                            TRACEME(("(#%d) key '%s' flags %x %u", i, keyval, flags, *keyval));
-                        } else {
-                            /* This is a workaround for a bug in 5.8.0
-                               that causes the HEK_WASUTF8 flag to be
-                               set on an HEK without the hash being
-                               marked as having key flags. We just
-                               cross our fingers and drop the flag.
-                               AMS 20030901 */
-                            assert (flags == 0 || flags == SHV_K_WASUTF8);
-                            TRACEME(("(#%d) key '%s'", i, keyval));
-                        }
-			WLEN(keylen);
-			if (keylen)
-				WRITE(keyval, keylen);
-                        if (flags & SHV_K_WASUTF8)
-                            Safefree (keyval);
-		}
-
-		/* 
-		 * Free up the temporary array
-		 */
-
-		av_undef(av);
-		sv_free((SV *) av);
+		ENTER;
+		SAVETMPS;
+		ret = store_hash_sorted(aTHX_ cxt, hv, len, hash_flags, flagged_hash);
+		FREETMPS;
+		LEAVE;
+		if (ret)
+			goto out;
 
 	} else {
 
@@ -3894,6 +4032,24 @@ static int do_store(
 
 	ASSERT(is_storing(aTHX), ("within store operation"));
 
+#ifdef USE_PTR_TABLE
+	/*
+	 * A big array or hash at the top means at least as many objects as
+	 * it has items will go into pseen, so size the table for them now,
+	 * while it is empty, rather than have it doubled and every entry
+	 * moved a dozen times or more along the way.
+	 */
+	if (!SvRMAGICAL(sv)) {
+		UV items = 0;
+		if (SvTYPE(sv) == SVt_PVAV)
+			items = AvFILLp((AV *) sv) + 1;
+		else if (SvTYPE(sv) == SVt_PVHV)
+			items = HvTOTALKEYS((HV *) sv);
+		while (cxt->pseen->tbl_max < items)
+			ptr_table_split(cxt->pseen);
+	}
+#endif
+
 	status = store(aTHX_ cxt, sv);		/* Just do it! */
 
 	/*
@@ -4317,7 +4473,7 @@ static SV *retrieve_hook(pTHX_ stcxt_t *cxt, const char *cname)
 
 			READ_I32(tag);
 			tag = ntohl(tag);
-			svh = av_fetch(cxt->aseen, tag, FALSE);
+			svh = SEEN_FETCH(tag);
 			if (!svh) {
 				if (tag == cxt->where_is_undef) {
 					/* av_fetch uses PL_sv_undef internally, hence this
@@ -5668,7 +5824,7 @@ static SV *retrieve_code(pTHX_ stcxt_t *cxt, const char *cname)
 		} else {
 			sv = newSVsv(sub);
 			/* fix up the dummy entry... */
-			av_store(cxt->aseen, tagnum, SvREFCNT_inc(sv));
+			av_store(cxt->aseen, tagnum - cxt->aseen_base, SvREFCNT_inc(sv));
 			return sv;
 		}
 	}
@@ -5709,7 +5865,7 @@ static SV *retrieve_code(pTHX_ stcxt_t *cxt, const char *cname)
 	FREETMPS;
 	LEAVE;
 	/* fix up the dummy entry... */
-	av_store(cxt->aseen, tagnum, SvREFCNT_inc(sv));
+	av_store(cxt->aseen, tagnum - cxt->aseen_base, SvREFCNT_inc(sv));
 
 	return sv;
 #endif
@@ -6111,7 +6267,7 @@ static SV *retrieve(pTHX_ stcxt_t *cxt, const char *cname)
 			 * The following code is common with the SX_OBJECT case below.
 			 */
 
-			svh = av_fetch(cxt->aseen, tagn, FALSE);
+			svh = SEEN_FETCH(tagn);
 			if (!svh)
 				CROAK(("Object #%"IVdf" should have been retrieved already",
 					(IV) tagn));
@@ -6152,7 +6308,7 @@ static SV *retrieve(pTHX_ stcxt_t *cxt, const char *cname)
 		I32 tag;
 		READ_I32(tag);
 		tag = ntohl(tag);
-		svh = av_fetch(cxt->aseen, tag, FALSE);
+		svh = SEEN_FETCH(tag);
 		if (!svh)
 			CROAK(("Object #%"IVdf" should have been retrieved already",
 				(IV) tag));
@@ -6226,22 +6382,218 @@ first_time:		/* Will disappear when support for old format is dropped */
 	return sv;	/* Ok */
 }
 
+#ifdef USE_SLURP_RETRIEVE
+
+/*
+ * slurp_file
+ *
+ * Read the rest of the plain file f is reading into memory, when it is
+ * big enough to be worth it and starts with our magic number.  Returns a
+ * mortal SV holding what was read, and sets *posp to where in the file
+ * that started.  Returns NULL, with f left where it was, to have f read
+ * through PerlIO instead, which is also how files made by versions before
+ * 0.6 are handled.
+ *
+ * The file is read rather than mapped: a mapping of a file which another
+ * process truncates while we are retrieving it would kill us with SIGBUS.
+ */
+static SV *slurp_file(pTHX_ PerlIO *f, Off_t *posp)
+{
+	const char *layer;
+	Stat_t st;
+	Off_t pos;
+	STRLEN size;
+	SSize_t got;
+	int fd;
+	SV *sv;
+
+	/* The bytes in the file must be the bytes we would read */
+	if (!PerlIOValid(f)
+	    || (PerlIOBase(f)->flags & (PERLIO_F_UTF8|PERLIO_F_CRLF)))
+		return (SV *) 0;
+	layer = PerlIOBase(f)->tab->name;
+	if (strNE(layer, "perlio") && strNE(layer, "unix")
+	    && strNE(layer, "stdio"))
+		return (SV *) 0;
+
+	fd = PerlIO_fileno(f);
+	if (fd < 0 || PerlLIO_fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return (SV *) 0;
+	pos = PerlIO_tell(f);
+	if (pos < 0 || st.st_size - pos < SLURP_MIN
+	    || st.st_size - pos > (Off_t) SSize_t_MAX)
+		return (SV *) 0;
+	size = (STRLEN) (st.st_size - pos);
+
+	sv = sv_2mortal(newSV(size));
+	got = PerlIO_read(f, SvPVX(sv), size);
+	if (got < (SSize_t) (sizeof(magicstr) - 1)
+	    || memNE(SvPVX(sv), magicstr, sizeof(magicstr) - 1)) {
+		PerlIO_seek(f, pos, SEEK_SET);
+		return (SV *) 0;
+	}
+
+	TRACEME(("read %"IVdf" bytes of file", (IV) got));
+
+	SvCUR_set(sv, (STRLEN) got);
+	SvPOK_only(sv);
+	*posp = pos;
+	return sv;
+}
+
+#endif /* USE_SLURP_RETRIEVE */
+
+/*
+ * retrieve_each
+ *
+ * Retrieve the elements of a root array or the pairs of a root hash one
+ * at a time, handing each of them to the callback `cb' as (index, value)
+ * or (key, value) before moving on to the next.  The root container is
+ * never built, and all the objects retrieved for an element are released
+ * once the callback returns, so that memory is bounded by the largest
+ * element instead of by the whole image.  The price is that an element
+ * cannot refer to anything held by a previous one.
+ *
+ * Returns the amount of elements handed over, as a new SV.
+ */
+static SV *retrieve_each(pTHX_ stcxt_t *cxt, SV *cb)
+{
+	I32 len;
+	I32 size;
+	I32 i;
+	int type;
+	int flags = 0;
+	IV count = 0;
+	SV *sv;
+	SV *key;
+
+	TRACEME(("retrieve_each"));
+
+	if (cxt->hseen)
+		CROAK(("Can't retrieve elements one at a time from a pre-0.7 image"));
+
+	GETMARK(type);
+	switch (type) {
+	case SX_FLAG_HASH:
+		GETMARK(flags);			/* Restricted or not, we don't build it */
+		/* FALL THROUGH */
+	case SX_ARRAY:
+	case SX_HASH:
+		break;
+	default:
+		CROAK(("Storable image root is not a plain array or hash"));
+	}
+
+	/*
+	 * The root container would be tag #0: leave its slot empty so that
+	 * any reference to it is reported.
+	 */
+
+	cxt->aseen_base = ++cxt->tagnum;
+
+	RLEN(len);
+	TRACEME(("root %s, size = %d", type == SX_ARRAY ? "array" : "hash", len));
+
+	for (i = 0; i < len; i++) {
+		TRACEME(("(#%d) value", i));
+		sv = retrieve(aTHX_ cxt, 0);
+		if (!sv)
+			return (SV *) 0;
+
+		if (type == SX_ARRAY)
+			key = newSViv(i);
+		else {
+			flags = 0;
+			if (type == SX_FLAG_HASH)
+				GETMARK(flags);
+			if (flags & SHV_K_ISSV) {
+				key = retrieve(aTHX_ cxt, 0);
+				if (!key)
+					return (SV *) 0;
+			} else {
+				RLEN(size);
+				KBUFCHK((STRLEN)size);
+				if (size)
+					READ(kbuf, size);
+				if (flags & SHV_K_PLACEHOLDER) {
+					SvREFCNT_dec(sv);	/* Locked key without a value */
+					goto release;
+				}
+				key = newSVpvn(kbuf, size);
+#ifdef HAS_UTF8_HASHES
+				if (flags & SHV_K_UTF8)
+					SvUTF8_on(key);
+				else if (flags & SHV_K_WASUTF8)
+					sv_utf8_upgrade(key);
+#endif
+			}
+		}
+
+		/*
+		 * Hand the pair over.  Should the callback die, the context is
+		 * marked dirty so that the next operation cleans it up.
+		 */
+
+		{
+			dSP;
+
+			ENTER;
+			SAVETMPS;
+			PUSHMARK(sp);
+			XPUSHs(sv_2mortal(key));
+			XPUSHs(sv_2mortal(sv));
+			PUTBACK;
+			(void) call_sv(cb, G_DISCARD|G_EVAL);
+			FREETMPS;
+			LEAVE;
+		}
+
+		if (SvTRUE(ERRSV))
+			CROAK((NULL));			/* Propagate the exception */
+
+		count++;
+
+	release:
+		/*
+		 * Nothing that follows may refer to what we retrieved so far.
+		 */
+
+		av_clear(cxt->aseen);
+		cxt->aseen_base = cxt->tagnum;
+		cxt->where_is_undef = -1;
+	}
+
+	TRACEME(("ok (retrieve_each, %"IVdf" elements)", count));
+
+	return newSViv(count);
+}
+
 /*
  * do_retrieve
  *
  * Retrieve data held in file and return the root object.
  * Common routine for pretrieve and mretrieve.
+ *
+ * When `each' is not NULL, the elements of the root are handed to that
+ * callback one at a time instead (see retrieve_each), and their count is
+ * returned.
  */
 static SV *do_retrieve(
         pTHX_
 	PerlIO *f,
 	SV *in,
-	int optype)
+	int optype,
+	SV *each)
 {
 	dSTCXT;
 	SV *sv;
 	int is_tainted;				/* Is input source tainted? */
 	int pre_06_fmt = 0;			/* True with pre Storable 0.6 formats */
+	PerlIO *fio = f;			/* Where I/O are performed */
+#ifdef USE_SLURP_RETRIEVE
+	SV *slurp = (SV *) 0;			/* The file, read into memory */
+	Off_t pos;
+#endif
 
 	TRACEME(("do_retrieve (optype = 0x%x)", optype));
 
@@ -6329,6 +6681,14 @@ static SV *do_retrieve(
 #endif
 		MBUF_SAVE_AND_LOAD(in);
 	}
+#ifdef USE_SLURP_RETRIEVE
+	else if (f && !each && (slurp = slurp_file(aTHX_ f, &pos))) {
+		/* We've checked the magic number, the rest is as for a string */
+		MBUF_SAVE_AND_LOAD(slurp);
+		mptr = mbase + sizeof(magicstr) - 1;
+		fio = (PerlIO *) 0;
+	}
+#endif
 
 	/*
 	 * Magic number verifications.
@@ -6338,11 +6698,11 @@ static SV *do_retrieve(
 	 * some of the initializations.
 	 */
 
-	cxt->fio = f;				/* Where I/O are performed */
+	cxt->fio = fio;
 
 	if (!magic_check(aTHX_ cxt))
 		CROAK(("Magic number checking on storable %s failed",
-			cxt->fio ? "file" : "string"));
+			f ? "file" : "string"));
 
 	TRACEME(("data stored in %s format",
 		cxt->netorder ? "net order" : "native"));
@@ -6363,7 +6723,10 @@ static SV *do_retrieve(
 
 	ASSERT(is_retrieving(aTHX), ("within retrieve operation"));
 
-	sv = retrieve(aTHX_ cxt, 0);		/* Recursively retrieve object, get root SV */
+	if (each)
+		sv = retrieve_each(aTHX_ cxt, each);
+	else
+		sv = retrieve(aTHX_ cxt, 0);	/* Recursively retrieve object, get root SV */
 
 	/*
 	 * Final cleanup.
@@ -6371,6 +6734,13 @@ static SV *do_retrieve(
 
 	if (!f && in)
 		MBUF_RESTORE();
+#ifdef USE_SLURP_RETRIEVE
+	else if (slurp) {
+		/* Leave f just after what we used, as if we had used PerlIO */
+		PerlIO_seek(f, pos + (Off_t) (mptr - mbase), SEEK_SET);
+		MBUF_RESTORE();
+	}
+#endif
 
 	pre_06_fmt = cxt->hseen != NULL;	/* Before we clean context */
 
@@ -6386,6 +6756,9 @@ static SV *do_retrieve(
 	 * Prepare returned value.
 	 */
 
+	if (each)
+		return sv ? sv : &PL_sv_undef;
+
 	if (!sv) {
 		TRACEME(("retrieve ERROR"));
 #if (PATCHLEVEL <= 4) 
@@ -6468,7 +6841,19 @@ static SV *do_retrieve(
 static SV *pretrieve(pTHX_ PerlIO *f)
 {
 	TRACEME(("pretrieve"));
-	return do_retrieve(aTHX_ f, Nullsv, 0);
+	return do_retrieve(aTHX_ f, Nullsv, 0, Nullsv);
+}
+
+/*
+ * pretrieve_each
+ *
+ * Hand the elements of the root object held in file to a callback, one
+ * at a time.  Returns their count, undef on error.
+ */
+static SV *pretrieve_each(pTHX_ PerlIO *f, SV *cb)
+{
+	TRACEME(("pretrieve_each"));
+	return do_retrieve(aTHX_ f, Nullsv, 0, cb);
 }
 
 /*
@@ -6479,7 +6864,7 @@ static SV *pretrieve(pTHX_ PerlIO *f)
 static SV *mretrieve(pTHX_ SV *sv)
 {
 	TRACEME(("mretrieve"));
-	return do_retrieve(aTHX_ (PerlIO*) 0, sv, 0);
+	return do_retrieve(aTHX_ (PerlIO*) 0, sv, 0, Nullsv);
 }
 
 /***
@@ -6562,7 +6947,7 @@ static SV *dclone(pTHX_ SV *sv)
 	 */
 
 	cxt->s_tainted = SvTAINTED(sv);
-	out = do_retrieve(aTHX_ (PerlIO*) 0, Nullsv, ST_CLONE);
+	out = do_retrieve(aTHX_ (PerlIO*) 0, Nullsv, ST_CLONE, Nullsv);
 
 	TRACEME(("dclone returns 0x%"UVxf, PTR2UV(out)));
 
@@ -6681,6 +7066,15 @@ InputStream	f
  OUTPUT:
   RETVAL
 
+SV *
+pretrieve_each(f, cb)
+InputStream	f
+SV *	cb
+ CODE:
+  RETVAL = pretrieve_each(aTHX_ f, cb);
+ OUTPUT:
+  RETVAL
+
 SV *
 mretrieve(sv)
 SV *	sv
@@ -20,7 +20,7 @@ sub BEGIN {
 use Storable qw(freeze thaw dclone);
 use vars qw($debugging $verbose);
 
-use Test::More tests => 8;
+use Test::More tests => 12;
 
 # Uncomment the following line to get a dump of the constructed data structure
 # (you may want to reduce the size of the hashes too)
@@ -137,3 +137,45 @@ is($$cloned{''}[0], \$$cloned{a});
 
 $$cloned{a} = "blah";
 is($$cloned{''}[0], \$$cloned{a});
+
+# Keys are ordered as sort() would order them, whatever their encoding,
+# and don't depend on the order they went into the hash
+{
+    local $Storable::canonical = 1;
+    my $up = "\xe9t\xe9";
+    utf8::upgrade($up);
+    my @keys = ("b", "", "\xe9", "\x{100}", "a\x{263a}", $up, "e", "\0");
+    my (%fwd, %rev);
+    $fwd{$_} = $_ for @keys;
+    $rev{$_} = $_ for reverse @keys;
+    is(freeze(\%fwd), freeze(\%rev), 'canonical with mixed utf8 keys');
+    my @order;
+    {
+        package Order;
+        sub STORABLE_freeze { push @order, $_[0][0]; "" }
+    }
+    my %obj = map { ($_ => bless [$_], 'Order') } @keys;
+    freeze(\%obj);
+    is(join("|", @order), join("|", sort @keys), 'values stored in key order');
+
+    SKIP: {
+        skip 'no Hash::Util', 1 unless eval { require Hash::Util };
+        my %locked = (a => 1, c => 3);
+        Hash::Util::lock_ref_keys(\%locked, qw(a b c d));
+        my %again = (c => 3, a => 1);
+        Hash::Util::lock_ref_keys(\%again, qw(d c b a));
+        is(freeze(\%locked), freeze(\%again), 'canonical restricted hash');
+    }
+
+    # A hook emptying the hash being stored mustn't pull the entries
+    # still to be stored out from under it
+    my %emptied = (a => bless([], 'Emptier'), b => 'bee', c => [ 'sea' ]);
+    {
+        package Emptier;
+        sub STORABLE_freeze { %emptied = (); "" }
+        sub STORABLE_thaw { }
+    }
+    my $copy = thaw(freeze(\%emptied));
+    ok($copy->{b} eq 'bee' && $copy->{c}[0] eq 'sea',
+       'canonical hash changed by a freeze hook');
+}
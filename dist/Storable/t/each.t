@@ -0,0 +1,92 @@
+#!./perl
+#
+#  Copyright (c) 2002-2014 by the Perl 5 Porters
+#
+#  You may redistribute only under the same terms as Perl 5, as specified
+#  in the README file that comes with the distribution.
+#
+
+sub BEGIN {
+    unshift @INC, 't';
+    unshift @INC, 't/compat' if $] < 5.006002;
+    require Config; import Config;
+    if ($ENV{PERL_CORE} and $Config{'extensions'} !~ /\bStorable\b/) {
+        print "1..0 # Skip: Storable was not built\n";
+        exit 0;
+    }
+}
+
+use Storable qw(store nstore retrieve retrieve_each fd_retrieve_each);
+use Test::More tests => 23;
+
+my $file = "each-$$";
+
+my @a = ('first', '', undef, 3, -4.5, [1, 2], {k => 'v'}, \'ref');
+my @keys = ();
+my @values = ();
+
+isnt(store(\@a, $file), undef);
+is(retrieve_each($file, sub { push @keys, $_[0]; push @values, $_[1] }),
+   scalar @a, 'retrieve_each returns the element count');
+is_deeply(\@keys, [0 .. $#a], 'array elements come with their index');
+is_deeply(\@values, \@a, 'array elements come in order');
+
+# Network order, and from an already opened file
+isnt(nstore(\@a, $file), undef);
+@values = ();
+open(my $fh, '<', $file) || die "can't open $file: $!";
+binmode $fh;
+is(fd_retrieve_each($fh, sub { push @values, $_[1] }), scalar @a);
+close $fh;
+is_deeply(\@values, \@a, 'fd_retrieve_each on a network order image');
+
+my %h = (a => 1, "\xe9" => [2], "\x{100}" => {three => 3}, '' => undef);
+my $upgraded = "\xe8";
+utf8::upgrade($upgraded);
+$h{$upgraded} = 4;
+my %got;
+isnt(store(\%h, $file), undef);
+is(retrieve_each($file, sub { $got{$_[0]} = $_[1] }), scalar keys %h);
+is_deeply(\%got, \%h, 'hash pairs, including utf8 keys');
+
+# Locked keys without a value are not handed over
+SKIP: {
+    skip "no Hash::Util", 2 unless eval { require Hash::Util; 1 };
+    my %r = (x => 1, y => 2);
+    Hash::Util::lock_ref_keys(\%r, qw(x y z));
+    %got = ();
+    isnt(store(\%r, $file), undef);
+    retrieve_each($file, sub { $got{$_[0]} = $_[1] });
+    is_deeply(\%got, {x => 1, y => 2}, 'restricted hash');
+}
+
+# Within an element, sharing is preserved
+my $shared = [1];
+isnt(store([[$shared, $shared]], $file), undef);
+retrieve_each($file, sub {
+    is($_[1][0], $_[1][1], 'shared references within an element');
+});
+
+# Across elements, it cannot be
+isnt(store([$shared, $shared], $file), undef);
+eval { retrieve_each($file, sub {}) };
+like($@, qr/should have been retrieved already/, 'sharing across elements');
+
+my $self = [];
+push @$self, $self;
+isnt(store($self, $file), undef);
+eval { retrieve_each($file, sub {}) };
+like($@, qr/should have been retrieved already/, 'reference to the root');
+
+isnt(store(\'scalar', $file), undef);
+eval { retrieve_each($file, sub {}) };
+like($@, qr/root is not a plain array or hash/, 'scalar root');
+
+# The callback can stop the iteration, and Storable still works afterwards
+isnt(store(\@a, $file), undef);
+my $seen = 0;
+eval { retrieve_each($file, sub { $seen++; die "enough\n" if $_[0] == 1 }) };
+ok($@ =~ /^enough/ && $seen == 2, 'exception from the callback');
+is_deeply(retrieve($file), \@a, 'retrieve after an interrupted iteration');
+
+END { 1 while unlink $file }
@@ -19,7 +19,7 @@ sub BEGIN {
 
 use Storable qw(freeze nfreeze thaw);
 
-use Test::More tests => 21;
+use Test::More tests => 24;
 
 $a = 'toto';
 $b = \$a;
@@ -134,3 +134,18 @@ SKIP: {
     is($@, '');
     is("@a", "@b");
 }
+
+# Big top-level containers, whose items sharing references must still be
+# spotted
+{
+    my @shared = map { { n => $_ } } 1 .. 10;
+    my @big = map { [ $_, $shared[$_ % 10] ] } 1 .. 5000;
+    my $copy = thaw freeze \@big;
+    is(scalar @$copy, 5000, 'big array thawed');
+    ok($copy->[0][1] == $copy->[10][1] && $copy->[0][1] != $copy->[1][1],
+       'references shared across a big array');
+    my %big = map { ("k$_" => $shared[$_ % 10]) } 1 .. 5000;
+    $copy = thaw freeze \%big;
+    ok($copy->{k1} == $copy->{k11} && $copy->{k1}{n} == 2,
+       'references shared across a big hash');
+}
@@ -18,8 +18,8 @@ sub BEGIN {
 }
 
 
-use Storable qw(store retrieve nstore);
-use Test::More tests => 14;
+use Storable qw(store retrieve nstore store_fd nstore_fd fd_retrieve);
+use Test::More tests => 24;
 
 $a = 'toto';
 $b = \$a;
@@ -54,4 +54,41 @@ is($d1, $d2);
 isnt($root->[1], undef);
 is(length $root->[1], 0);
 
+# Files big enough to be read into memory in one go
+my @big = map { [ $_, "item $_" x 10, { n => -$_ } ] } 1..2000;
+isnt(store(\@big, 'store'), undef);
+cmp_ok(-s 'store', '>', 1 << 16, 'big file is big');
+$root = retrieve('store');
+is(&dump($root), &dump(\@big), 'retrieve a big file');
+
+open(OUT, '>', 'store') or die "Could not open store: $!";
+binmode OUT;
+isnt(store_fd(\@big, ::OUT), undef);
+isnt(nstore_fd([ reverse @big ], ::OUT), undef);
+close OUT or die "Could not close: $!";
+
+open(OUT, 'store') or die "Could not open store: $!";
+binmode OUT;
+$root = fd_retrieve(::OUT);
+is(&dump($root), &dump(\@big), 'fd_retrieve the first of two big images');
+$root = fd_retrieve(::OUT);
+is(&dump($root), &dump([ reverse @big ]), '... and the second');
+ok(eof(OUT), '... leaving the handle at the end');
+close OUT or die "Could not close: $!";
+
+# A big file truncated while it is being retrieved
+{
+    package Truncator;
+    sub STORABLE_freeze { return $_[0][0] }
+    sub STORABLE_thaw {
+        my ($self, $cloning, $serialized) = @_;
+        truncate('store', 0) or die "Could not truncate store: $!";
+        @$self = ($serialized);
+    }
+}
+isnt(store([ bless([ 'first' ], 'Truncator'), @big ], 'store'), undef);
+$root = retrieve('store');
+is(&dump($root && $root->[1]), &dump($big[0]),
+   'retrieve a big file truncated part way through');
+
 END { 1 while unlink('store', 'nstore') }
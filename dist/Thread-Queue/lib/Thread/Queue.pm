@@ -3,10 +3,10 @@ package Thread::Queue;
 use strict;
 use warnings;
 
-our $VERSION = '3.05';
+our $VERSION = '3.06';
 $VERSION = eval $VERSION;
 
-use threads::shared 1.21;
+use threads::shared 1.49;
 use Scalar::Util 1.10 qw(looks_like_number blessed reftype refaddr);
 
 # Carp errors from threads::shared calls should complain about caller
@@ -30,7 +30,8 @@ sub enqueue
         require Carp;
         Carp::croak("'enqueue' method called on queue that has been 'end'ed");
     }
-    push(@{$$self{'queue'}}, map { shared_clone($_) } @_)
+    # Ordinary scalars are copied by the push itself
+    push(@{$$self{'queue'}}, map { ref($_) ? shared_clone($_) : $_ } @_)
         and cond_signal(%$self);
 }
 
@@ -74,8 +75,7 @@ sub dequeue
     return shift(@$queue) if ($count == 1);
 
     # Return multiple items
-    my @items;
-    push(@items, shift(@$queue)) for (1..$count);
+    my @items = splice(@$queue, 0, $count);
     return @items;
 }
 
@@ -92,11 +92,7 @@ sub dequeue_nb
     return shift(@$queue) if ($count == 1);
 
     # Return multiple items
-    my @items;
-    for (1..$count) {
-        last if (! @$queue);
-        push(@items, shift(@$queue));
-    }
+    my @items = splice(@$queue, 0, $count);
     return @items;
 }
 
@@ -158,19 +154,12 @@ sub insert
         if ($index < 0) {
             $index = 0;
         }
-    }
-
-    # Dequeue items from $index onward
-    my @tmp;
-    while (@$queue > $index) {
-        unshift(@tmp, pop(@$queue))
+    } elsif ($index > @$queue) {
+        $index = @$queue;
     }
 
     # Add new items to the queue
-    push(@$queue, map { shared_clone($_) } @_);
-
-    # Add previous items back onto the queue
-    push(@$queue, @tmp);
+    splice(@$queue, $index, 0, map { ref($_) ? shared_clone($_) : $_ } @_);
 
     # Soup's up
     cond_signal(%$self);
@@ -196,18 +185,8 @@ sub extract
         }
     }
 
-    # Dequeue items from $index+$count onward
-    my @tmp;
-    while (@$queue > ($index+$count)) {
-        unshift(@tmp, pop(@$queue))
-    }
-
     # Extract desired items
-    my @items;
-    unshift(@items, pop(@$queue)) while (@$queue > $index);
-
-    # Add back any removed items
-    push(@$queue, @tmp);
+    my @items = ($index < @$queue) ? splice(@$queue, $index, $count) : ();
 
     # Return single item
     return $items[0] if ($count == 1);
@@ -289,7 +268,7 @@ Thread::Queue - Thread-safe queues
 
 =head1 VERSION
 
-This document describes Thread::Queue version 3.05
+This document describes Thread::Queue version 3.06
 
 =head1 SYNOPSIS
 
@@ -425,6 +404,10 @@ queue, and returns them.  If the queue contains fewer than the requested
 number of items, then the thread will be blocked until the requisite number
 of items are available (i.e., until other threads <enqueue> more items).
 
+Items passed to one C<enqueue> call, and items taken by one C<dequeue(COUNT)>
+call, are moved with a single operation on the shared queue.  Batching work
+this way is much faster than handling items one call at a time.
+
 =item ->dequeue_nb()
 
 =item ->dequeue_nb(COUNT)
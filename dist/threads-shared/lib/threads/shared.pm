@@ -7,7 +7,7 @@ use warnings;
 
 use Scalar::Util qw(reftype refaddr blessed);
 
-our $VERSION = '1.48'; # Please update the pod, too.
+our $VERSION = '1.49'; # Please update the pod, too.
 my $XS_VERSION = $VERSION;
 $VERSION = eval $VERSION;
 
@@ -66,13 +66,6 @@ my ($make_shared);
 
 ### Methods, etc. ###
 
-sub threads::shared::tie::SPLICE
-{
-    require Carp;
-    Carp::croak('Splice not implemented for shared arrays');
-}
-
-
 # Create a thread-shared clone of a complex data structure or object
 sub shared_clone
 {
@@ -195,7 +188,7 @@ threads::shared - Perl extension for sharing data structures between threads
 
 =head1 VERSION
 
-This document describes threads::shared version 1.48
+This document describes threads::shared version 1.49
 
 =head1 SYNOPSIS
 
@@ -570,8 +563,8 @@ global destruction time.  If the destructors must be called, make sure
 there are no circular references and that nothing is referencing the
 objects, before the program ends.
 
-Does not support C<splice> on arrays.  Does not support explicitly changing
-array lengths via $#array -- use C<push> and C<pop> instead.
+Does not support explicitly changing array lengths via $#array -- use
+C<push> and C<pop> instead.
 
 Taking references to the elements of shared arrays and hashes does not
 autovivify the elements, and neither does slicing a shared array/hash over
@@ -170,6 +170,7 @@ typedef struct {
     perl_mutex          mutex;
     PerlInterpreter    *owner;
     I32                 locks;
+    I32                 waiters;
     perl_cond           cond;
 #ifdef DEBUG_LOCKS
     const char *        file;
@@ -201,7 +202,8 @@ recursive_lock_release(pTHX_ recursive_lock_t *lock)
     if (lock->owner == aTHX) {
         if (--lock->locks == 0) {
             lock->owner = NULL;
-            COND_SIGNAL(&lock->cond);
+            if (lock->waiters)
+                COND_SIGNAL(&lock->cond);
         }
     }
     MUTEX_UNLOCK(&lock->mutex);
@@ -222,7 +224,9 @@ recursive_lock_acquire(pTHX_ recursive_lock_t *lock, const char *file, int line)
             Perl_warn(aTHX_ " %p waiting - owned by %p %s:%d\n",
                       aTHX, lock->owner, lock->file, lock->line);
 #endif
+            lock->waiters++;
             COND_WAIT(&lock->cond,&lock->mutex);
+            lock->waiters--;
         }
         lock->locks = 1;
         lock->owner = aTHX;
@@ -734,8 +738,17 @@ int
 sharedsv_scalar_mg_get(pTHX_ SV *sv, MAGIC *mg)
 {
     SV *ssv = (SV *) mg->mg_ptr;
+    MAGIC *emg;
     assert(ssv);
 
+    /* An element of a shared array or hash is refetched by its tiedelem
+     * magic, which mg_get() calls along with this */
+    if ((emg = mg_find(sv, PERL_MAGIC_tiedelem))
+        && emg->mg_virtual == &sharedsv_elem_vtbl)
+    {
+        return (0);
+    }
+
     ENTER_LOCK;
     if (SvROK(ssv)) {
         get_RV(sv, SvRV(ssv));
@@ -1357,6 +1370,106 @@ SHIFT(SV *obj)
         /* XSRETURN(1); - implied */
 
 
+void
+SPLICE(SV *obj, ...)
+    PPCODE:
+        dTHXc;
+        SV *sobj = SHAREDSV_FROM_OBJ(obj);
+        const U8 gimme = GIMME_V;
+        IV off = (items > 1) ? SvIV(ST(1)) : 0;
+        IV len = (items > 2) ? SvIV(ST(2)) : 0;
+        IV add = (items > 3) ? items - 3 : 0;
+        IV size, tail, ii;
+        SV **added;
+        SV **removed;
+        bool past_end = FALSE;
+        /* Copy and check the new elements before taking the lock, so that
+         * an unshareable value croaks before anything shared is made */
+        for (ii = 0; ii < add; ii++) {
+            SV *tmp = sv_2mortal(newSVsv(ST(ii + 3)));
+            if (SvROK(tmp) && ! Perl_sharedsv_find(aTHX_ SvRV(tmp))) {
+                Perl_croak(aTHX_ "Invalid value for shared scalar");
+            }
+            ST(ii + 3) = tmp;
+        }
+        ENTER_LOCK;
+        size = AvFILLp((AV*)sobj) + 1;
+        if (off < 0) {
+            off += size;
+            if (off < 0) {
+                Perl_croak(aTHX_ "Modification of non-creatable array value attempted, subscript %" IVdf, off - size);
+            }
+        }
+        if (off > size) {
+            past_end = (items > 2);
+            off = size;
+        }
+        if (items <= 2) {
+            len = size - off;
+        } else if (len < 0) {
+            len += size - off;
+            if (len < 0) {
+                len = 0;
+            }
+        }
+        if (len > size - off) {
+            len = size - off;
+        }
+        tail = size - off - len;
+        Newx(added, add + 1, SV*);
+        SAVEFREEPV(added);
+        Newx(removed, len + 1, SV*);
+        SAVEFREEPV(removed);
+        for (ii = 0; ii < add; ii++) {
+            SV *tmp = ST(ii + 3);
+            U32 dualvar_flags = DUALVAR_FLAGS(tmp);
+            SV *stmp = S_sharedsv_new_shared(aTHX_ tmp);
+            sharedsv_scalar_store(aTHX_ tmp, stmp);
+            SvFLAGS(stmp) |= dualvar_flags;
+            SvREFCNT_inc_void(stmp);
+            added[ii] = stmp;
+        }
+        SHARED_CONTEXT;
+        if (add > len) {
+            av_extend((AV*)sobj, size - len + add - 1);
+        }
+        {
+            SV **ary = AvARRAY((AV*)sobj);
+            Copy(ary + off, removed, len, SV*);
+            if (add != len) {
+                Move(ary + off + len, ary + off + add, tail, SV*);
+                if (add < len) {
+                    Zero(ary + off + add + tail, len - add, SV*);
+                }
+            }
+            Copy(added, ary + off, add, SV*);
+            AvFILLp((AV*)sobj) = size - len + add - 1;
+        }
+        CALLER_CONTEXT;
+        /* Hand the removed elements back as private proxies, so that they
+         * are released in this thread like those from SHIFT */
+        if (gimme == G_ARRAY) {
+            EXTEND(SP, len);
+        }
+        for (ii = 0; ii < len; ii++) {
+            SV *sv = sv_newmortal();
+            if (removed[ii]) {
+                Perl_sharedsv_associate(aTHX_ sv, removed[ii]);
+                SvREFCNT_dec(removed[ii]);
+            }
+            if (gimme == G_ARRAY) {
+                PUSHs(sv);
+            } else if (gimme == G_SCALAR && ii == len - 1) {
+                XPUSHs(sv);
+            }
+        }
+        LEAVE_LOCK;
+        if (past_end && ckWARN(WARN_MISC)) {
+            Perl_warner(aTHX_ packWARN(WARN_MISC),
+                    "splice() offset past end of array");
+        }
+
+
 void
 EXTEND(SV *obj, IV count)
     CODE:
@@ -1576,7 +1689,9 @@ cond_wait(SV *ref_cond, SV *ref_lock = 0)
         COND_WAIT(user_condition, &ul->lock.mutex);
         while (ul->lock.owner != NULL) {
             /* OK -- must reacquire the lock */
+            ul->lock.waiters++;
             COND_WAIT(&ul->lock.cond, &ul->lock.mutex);
+            ul->lock.waiters--;
         }
         ul->lock.owner = aTHX;
         ul->lock.locks = locks;
@@ -1626,7 +1741,9 @@ cond_timedwait(SV *ref_cond, double abs, SV *ref_lock = 0)
         RETVAL = Perl_sharedsv_cond_timedwait(user_condition, &ul->lock.mutex, abs);
         while (ul->lock.owner != NULL) {
             /* OK -- must reacquire the lock... */
+            ul->lock.waiters++;
             COND_WAIT(&ul->lock.cond, &ul->lock.mutex);
+            ul->lock.waiters--;
         }
         ul->lock.owner = aTHX;
         ul->lock.locks = locks;
@@ -27,7 +27,7 @@ sub ok {
 
 BEGIN {
     $| = 1;
-    print("1..47\n");   ### Number of tests that will be run ###
+    print("1..58\n");   ### Number of tests that will be run ###
 };
 
 use threads;
@@ -122,10 +122,8 @@ ok(37, !defined delete($foo[0]), "Check that delete works from a thread");
     ok(42,$foo[0] eq "hej", "Check slice assign");
 }
 {
-    eval {
-        my @t1 = splice(@foo,0,2,"hop", "hej");
-    };
-    ok(43, my $temp1 = $@ =~/Splice not implemented for shared arrays/, "Check that the warning message is correct for non splice");
+    my @t1 = splice(@foo,0,2,"hop", "hej");
+    ok(43, "@t1" eq "hej hop" && "@foo" eq "hop hej 3 4 5", "Check splice");
 }
 
 ok(44, is_shared(@foo), "Check for sharing");
@@ -139,6 +137,43 @@ ok(45, $#foo == 2,        "\$#foo assignment: \$#");
 ok(46, @foo  == 3,        "\$#foo assignment: scalar");
 ok(47, "@foo" eq "a b c", "\$#foo assignment: array interpolation");
 
+# splice
+
+@foo = (1..10);
+ok(48, join(',', splice(@foo, 2, 3)) eq '3,4,5'
+       && "@foo" eq "1 2 6 7 8 9 10", "splice removes from the middle");
+ok(49, scalar(splice(@foo, -2)) == 10
+       && "@foo" eq "1 2 6 7 8", "splice with negative offset in scalar context");
+splice(@foo, 1, 1, 'a'..'d');
+ok(50, "@foo" eq "1 a b c d 6 7 8", "splice inserting more than it removes");
+splice(@foo, 1, 4, 'x');
+ok(51, "@foo" eq "1 x 6 7 8", "splice inserting less than it removes");
+splice(@foo, 1, -1);
+ok(52, "@foo" eq "1 8", "splice with negative length");
+threads->create(sub { push(@foo, splice(@foo, 0, 1, shared_clone([ 'r' ]), shared_clone({ k => 'v' }))) })->join();
+ok(53, ref($foo[0]) eq 'ARRAY' && $foo[0][0] eq 'r' && $foo[1]{'k'} eq 'v'
+       && $foo[2] == 8 && $foo[3] == 1 && is_shared($foo[0]), "splice in a thread");
+ok(54, join(',', map { ref || $_ } splice(@foo)) eq 'ARRAY,HASH,8,1'
+       && ! @foo, "splice with no offset empties the array");
+eval { splice(@foo, -1, 0, 1) };
+ok(55, $@ =~ /^Modification of non-creatable array value attempted/,
+       "splice before the start of the array croaks");
+@foo = (1, 2);
+eval { splice(@foo, 1, 0, 'x', [ 'not shared' ]) };
+ok(56, $@ =~ /^Invalid value for shared scalar/ && "@foo" eq "1 2",
+       "splice of an unshareable value croaks without changing the array");
+{
+    my @warn;
+    local $SIG{__WARN__} = sub { push(@warn, @_) };
+    splice(@foo, 5, 0, 3);
+    ok(57, "@foo" eq "1 2 3" && @warn == 1
+           && $warn[0] =~ /^splice\(\) offset past end of array/,
+           "splice past the end of the array warns");
+    @warn = ();
+    splice(@foo, 5);
+    ok(58, ! @warn, "splice past the end with no length does not warn");
+}
+
 
 exit(0);
 
@@ -27,6 +27,15 @@
 #include <signal.h>
 #endif
 
+/* The tr/// table-driven routines below look at the code point of every
+ * character of a UTF-8 string.  Invariant characters, which usually make up
+ * the bulk of it, are their own code point, so only the others need the
+ * full decode */
+#define TRANS_UTF8_TO_UVCHR(s, e, lenp)                                     \
+    (UTF8_IS_INVARIANT(*(s))                                                \
+     ? (*(lenp) = 1, (UV) *(s))                                             \
+     : utf8n_to_uvchr((s), (e) - (s), (lenp), UTF8_ALLOW_DEFAULT))
+
 STATIC I32
 S_do_trans_simple(pTHX_ SV * const sv)
 {
@@ -69,7 +78,7 @@ S_do_trans_simple(pTHX_ SV * const sv)
 	    I32 ch;
 
 	    /* Need to check this, otherwise 128..255 won't match */
-	    const UV c = utf8n_to_uvchr(s, send - s, &ulen, UTF8_ALLOW_DEFAULT);
+	    const UV c = TRANS_UTF8_TO_UVCHR(s, send, &ulen);
 	    if (c < 0x100 && (ch = tbl[c]) >= 0) {
 		matches++;
 		d = uvchr_to_utf8(d, ch);
@@ -119,7 +128,7 @@ S_do_trans_count(pTHX_ SV * const sv)
 	const I32 complement = PL_op->op_private & OPpTRANS_COMPLEMENT;
 	while (s < send) {
 	    STRLEN ulen;
-	    const UV c = utf8n_to_uvchr(s, send - s, &ulen, UTF8_ALLOW_DEFAULT);
+	    const UV c = TRANS_UTF8_TO_UVCHR(s, send, &ulen);
 	    if (c < 0x100) {
 		if (tbl[c] >= 0)
 		    matches++;
@@ -204,8 +213,7 @@ S_do_trans_complex(pTHX_ SV * const sv)
 	    UV pch = 0xfeedface;
 	    while (s < send) {
 		STRLEN len;
-		const UV comp = utf8n_to_uvchr(s, send - s, &len,
-					       UTF8_ALLOW_DEFAULT);
+		const UV comp = TRANS_UTF8_TO_UVCHR(s, send, &len);
 		I32 ch;
 
 		if (comp > 0xff) {
@@ -250,8 +258,7 @@ S_do_trans_complex(pTHX_ SV * const sv)
 	else {
 	    while (s < send) {
 		STRLEN len;
-		const UV comp = utf8n_to_uvchr(s, send - s, &len,
-					       UTF8_ALLOW_DEFAULT);
+		const UV comp = TRANS_UTF8_TO_UVCHR(s, send, &len);
 		I32 ch;
 		if (comp > 0xff) {
 		    if (!complement) {
@@ -676,6 +683,41 @@ Perl_do_join(pTHX_ SV *sv, SV *delim, SV **mark, SV **sp)
     mark++;
     len = (items > 0 ? (delimlen * (items - 1) ) : 0);
     SvUPGRADE(sv, SVt_PV);
+
+    /* If the delimiter and every item are plain byte strings, with no
+     * magic to call, add up the length and copy them straight in */
+    if (!DO_UTF8(delim) && delim != sv) {
+	SSize_t i;
+	for (i = 0; i < items; i++) {
+	    const SV * const isv = mark[i];
+	    if (!isv || isv == sv
+		|| (SvFLAGS(isv) & (SVf_POK|SVf_UTF8|SVs_GMG)) != SVf_POK)
+		break;
+	    len += SvCUR(isv);
+	}
+	if (i == items) {
+	    char *d;
+	    sv_setpvs(sv, "");
+	    SvUTF8_off(sv);
+	    if (TAINTING_get && SvMAGICAL(sv))
+		SvTAINTED_off(sv);
+	    d = SvGROW(sv, len + 1);
+	    for (i = 0; i < items; i++) {
+		if (i && delimlen) {
+		    Copy(delims, d, delimlen, char);
+		    d += delimlen;
+		}
+		Copy(SvPVX_const(mark[i]), d, SvCUR(mark[i]), char);
+		d += SvCUR(mark[i]);
+	    }
+	    *d = '\0';
+	    SvCUR_set(sv, d - SvPVX_const(sv));
+	    SvSETMAGIC(sv);
+	    return;
+	}
+	len = (items > 0 ? (delimlen * (items - 1) ) : 0);
+    }
+
     if (SvLEN(sv) < len + items) {	/* current length is way too short */
 	while (items-- > 0) {
 	    if (*mark && !SvGAMAGIC(*mark) && SvOK(*mark)) {
@@ -1531,6 +1531,7 @@
 #define forget_pmop(a)		S_forget_pmop(aTHX_ a)
 #define gen_constant_list(a)	S_gen_constant_list(aTHX_ a)
 #define inplace_aassign(a)	S_inplace_aassign(aTHX_ a)
+#define is_foreach_split(a)	S_is_foreach_split(aTHX_ a)
 #define is_handle_constructor	S_is_handle_constructor
 #define listkids(a)		S_listkids(aTHX_ a)
 #define looks_like_bool(a)	S_looks_like_bool(aTHX_ a)
@@ -1661,6 +1662,7 @@
 #  endif
 #  if defined(PERL_IN_SV_C)
 #define F0convert		S_F0convert
+#define Fconvert		S_Fconvert
 #define anonymise_cv_maybe(a,b)	S_anonymise_cv_maybe(aTHX_ a,b)
 #define assert_uft8_cache_coherent(a,b,c,d)	S_assert_uft8_cache_coherent(aTHX_ a,b,c,d)
 #define curse(a,b)		S_curse(aTHX_ a,b)
@@ -1683,6 +1685,7 @@
 #define sv_pos_u2b_midway	S_sv_pos_u2b_midway
 #define sv_unglob(a,b)		S_sv_unglob(aTHX_ a,b)
 #define uiv_2buf		S_uiv_2buf
+#define utf8_mg_index_build(a,b,c,d)	S_utf8_mg_index_build(aTHX_ a,b,c,d)
 #define utf8_mg_len_cache_update(a,b,c)	S_utf8_mg_len_cache_update(aTHX_ a,b,c)
 #define utf8_mg_pos_cache_update(a,b,c,d,e)	S_utf8_mg_pos_cache_update(aTHX_ a,b,c,d,e)
 #define visit(a,b,c)		S_visit(aTHX_ a,b,c)
@@ -1745,6 +1748,7 @@
 #  endif
 #  if defined(PERL_IN_UTF8_C)
 #define check_locale_boundary_crossing(a,b,c,d)	S_check_locale_boundary_crossing(aTHX_ a,b,c,d)
+#define find_variant_byte	S_find_variant_byte
 #define is_utf8_common(a,b,c,d)	S_is_utf8_common(aTHX_ a,b,c,d)
 #define swash_scan_list_line(a,b,c,d,e,f,g)	S_swash_scan_list_line(aTHX_ a,b,c,d,e,f,g)
 #define swatch_get(a,b,c)	S_swatch_get(aTHX_ a,b,c)
@@ -4,7 +4,7 @@ package re;
 use strict;
 use warnings;
 
-our $VERSION     = "0.30";
+our $VERSION     = "0.31";
 our @ISA         = qw(Exporter);
 our @EXPORT_OK   = ('regmust',
                     qw(is_regexp regexp_pattern
@@ -112,8 +112,10 @@ sub bits {
     my $on = shift;
     my $bits = 0;
     my %seen;   # Has flag already been seen?
+    my $skip;   # Argument already consumed as a subpragma's value
    ARG:
     foreach my $idx (0..$#_){
+        next ARG if $skip && $skip--;
         my $s=$_[$idx];
         if ($s eq 'Debug' or $s eq 'Debugcolor') {
             setcolor() if $s =~/color/i;
@@ -139,6 +141,21 @@ sub bits {
 	    last;
         } elsif (exists $bitmask{$s}) {
 	    $bits |= $bitmask{$s};
+	} elsif ($s eq 'budget') {
+            if ($on) {
+                my $n = $_[$idx+1];
+                $skip = 1;
+                if (!defined $n or $n !~ /\A[0-9]+\z/ or !$n) {
+                    require Carp;
+                    Carp::carp("\"re\" subpragma 'budget' needs a positive "
+                             . "integer argument");
+                    next ARG;
+                }
+                $^H{re_budget} = $n;
+            }
+            else {
+                delete $^H{re_budget};
+            }
 	} elsif ($EXPORT_OK{$s}) {
 	    require Exporter;
 	    re->export_to_level(2, 're', $s);
@@ -233,7 +250,8 @@ sub bits {
 	} else {
 	    require Carp;
 	    Carp::carp("Unknown \"re\" subpragma '$s' (known ones are: ",
-                       join(', ', map {qq('$_')} 'debug', 'debugcolor', sort keys %bitmask),
+                       join(', ', map {qq('$_')} 'budget', 'debug', 'debugcolor',
+                                                sort keys %bitmask),
                        ")");
 	}
     }
@@ -296,6 +314,9 @@ re - Perl pragma to alter regular expression behaviour
     no re '/x';
     "FOO" =~ /foo/; # just /i implied
 
+    use re budget => 100_000;      # fail matches that would need to
+    $input =~ /^a*a*a*b/;          # backtrack more than 100_000 times
+
     use re 'debug';		   # output debugging info during
     /^(.*)$/s;			   # compile and run time
 
@@ -431,6 +452,25 @@ example:
     use re "/l";
     no re "/l"; # reverts to unicode_strings behaviour
 
+=head2 'budget' mode
+
+When C<use re budget =E<gt> $n> is in effect, regular expressions compiled
+in its scope may backtrack at most C<$n> times during a single match.  A
+match that would need more than that fails instead, no matter how many
+starting positions are still left to try, and a warning in the C<"regexp">
+category is raised.  This puts a bound on the time a pattern with
+pathological backtracking behaviour can spend on untrusted input, without
+resorting to C<alarm>.
+
+    use re budget => 10_000;
+    my $ok = $untrusted =~ /^\s*(\w+\s*)*=/;  # gives up, rather than
+                                              # running for ages
+
+The budget is a property of the compiled pattern, so it stays with a
+C<qr//> object created in its scope even when that object is used
+elsewhere.  C<no re 'budget'> turns the limit off for patterns compiled
+afterwards in the lexical scope.
+
 =head2 'debug' mode
 
 When C<use re 'debug'> is in effect, perl emits debugging messages when
@@ -0,0 +1,60 @@
+#!./perl
+
+BEGIN {
+        require Config;
+        if (($Config::Config{'extensions'} !~ /\bre\b/) ){
+                print "1..0 # Skip -- Perl configured without re module\n";
+                exit 0;
+        }
+}
+
+use strict;
+use warnings;
+
+use Test::More tests => 13;
+
+# Needs a lot of backtracking (but not in a CURLYX, where the super-linear
+# cache would rescue it) before it can fail.
+my $str = ("a" x 40) . "c";
+
+{
+    my @w;
+    local $SIG{__WARN__} = sub { push @w, @_ };
+
+    ok($str !~ /^a*a*a*a*a*[bd]/, 'no budget: pathological match fails');
+    is(scalar @w, 0, 'no budget: no warning');
+
+    {
+        use re budget => 1000;
+        ok($str !~ /^a*a*a*a*a*[bd]/, 'budget: pathological match fails');
+        is(scalar @w, 1, 'budget: one warning');
+        like($w[0], qr/^Regular expression backtracking budget \(1000\) exhausted/,
+             'budget: warning text');
+
+        @w = ();
+        ok("xxaab" =~ /a+b/, 'budget: ordinary match still matches');
+        ok("xxaab" =~ /^(.*?)(a+)b$/ && $1 eq 'xx' && $2 eq 'aa',
+           'budget: ordinary backtracking within the budget');
+        ok("aaaaac" =~ /^a*a*c/, 'budget: small pathological match matches');
+        is(scalar @w, 0, 'budget: no warnings while within budget');
+
+        my $qr = qr/^a*a*a*a*a*[bd]/;
+        no re 'budget';
+        ok($str !~ /^a*a*a*a*a*[bd]/ && !@w, 'no re "budget" removes limit');
+        ok($str !~ $qr && @w == 1, 'budget stays with the qr// object');
+
+        @w = ();
+        {
+            no warnings 'regexp';
+            ok($str !~ $qr && !@w, 'no warnings "regexp" silences the warning');
+        }
+    }
+}
+
+{
+    my @w;
+    local $SIG{__WARN__} = sub { push @w, @_ };
+    eval q{ use re budget => 'lots'; 1 };
+    like($w[0], qr/subpragma 'budget' needs a positive integer/,
+         'bad budget argument is rejected');
+}
@@ -1181,6 +1181,105 @@ S_my_atof_infnan(const char* s, bool negative, const char* send, NV* value)
     return NULL;
 }
 
+#if defined(USE_PERL_ATOF) && !defined(USE_QUADMATH)
+
+/* Whether each NV operation is rounded to NV precision, rather than to
+ * that of wider registers, as S_my_atof_fast() relies on */
+#if defined(FLT_EVAL_METHOD)
+#  define NV_EVAL_IS_NV (FLT_EVAL_METHOD == 0)
+#elif defined(__FLT_EVAL_METHOD__)
+#  define NV_EVAL_IS_NV (__FLT_EVAL_METHOD__ == 0)
+#else
+#  define NV_EVAL_IS_NV 0
+#endif
+
+/* The common case for Perl_my_atof2(): up to 19 significant digits which
+ * fit exactly in an NV, with an overall decimal exponent small enough
+ * that the power of ten is exact too.  Then a single multiplication or
+ * division gives the correctly rounded result (Clinger's fast path).
+ * Otherwise returns NULL, without looking at *value, for the general
+ * code to start again from s. */
+
+static char*
+S_my_atof_fast(pTHX_ const char* s, const char* send, bool negative,
+               NV* value)
+{
+#if defined(NV_MANT_DIG) && NV_MANT_DIG == 53 && FLT_RADIX == 2 \
+ && UVSIZE == 8 && NV_EVAL_IS_NV
+    static const NV pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    UV mantissa = 0;
+    int sig_digits = 0;
+    I32 exponent = 0;
+    bool seen_digit = 0;
+    bool seen_dp = 0;
+    NV result;
+
+    while (1) {
+        if (isDIGIT(*s)) {
+            seen_digit = 1;
+            if (mantissa || *s != '0') {
+                if (++sig_digits > 19)
+                    return NULL;
+                mantissa = mantissa * 10 + (*s - '0');
+            }
+            if (seen_dp)
+                exponent--;
+            s++;
+        }
+        else if (!seen_dp && GROK_NUMERIC_RADIX(&s, send))
+            seen_dp = 1;
+        else
+            break;
+    }
+
+    if (seen_digit && (isALPHA_FOLD_EQ(*s, 'e'))) {
+        bool expnegative = 0;
+        I32 exp_digits = 0;
+        I32 e = 0;
+
+        ++s;
+        switch (*s) {
+            case '-':
+                expnegative = 1;
+                /* FALLTHROUGH */
+            case '+':
+                ++s;
+        }
+        while (isDIGIT(*s)) {
+            if (++exp_digits > 4)
+                return NULL;
+            e = e * 10 + (*s++ - '0');
+        }
+        exponent += expnegative ? -e : e;
+    }
+
+    if (mantissa > ((UV)1 << 53) || exponent < -22 || exponent > 22) {
+        if (mantissa)
+            return NULL;
+        exponent = 0;
+    }
+    result = (NV)mantissa;
+    if (exponent < 0)
+        result /= pow10[-exponent];
+    else
+        result *= pow10[exponent];
+    *value = negative ? -result : result;
+    return (char*)s;
+#else
+    PERL_UNUSED_CONTEXT;
+    PERL_UNUSED_ARG(s);
+    PERL_UNUSED_ARG(send);
+    PERL_UNUSED_ARG(negative);
+    PERL_UNUSED_ARG(value);
+    return NULL;
+#endif
+}
+
+#endif
+
 char*
 Perl_my_atof2(pTHX_ const char* orig, NV* value)
 {
@@ -1267,6 +1366,8 @@ Perl_my_atof2(pTHX_ const char* orig, NV* value)
         const char* endp;
         if ((endp = S_my_atof_infnan(s, negative, send, value)))
             return (char*)endp;
+        if ((endp = S_my_atof_fast(aTHX_ s, send, negative, value)))
+            return (char*)endp;
     }
 
     /* we accumulate digits into an integer; when this becomes too
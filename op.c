@@ -7384,6 +7384,50 @@ Perl_newWHILEOP(pTHX_ I32 flags, I32 debuggable, LOOP *loop,
     return o;
 }
 
+/* Whether a foreach over this split can have the fields cut out of the
+ * string one at a time as the loop goes round (see pp_iter) instead of
+ * all being made up front.  That needs a constant pattern that is one
+ * ASCII byte, no limit, and nothing but the stack to put the fields on. */
+
+STATIC bool
+S_is_foreach_split(pTHX_ const OP *o)
+{
+    const PMOP *pm;
+    const OP *limit;
+    REGEXP *rx;
+    SV *csv;
+
+    PERL_ARGS_ASSERT_IS_FOREACH_SPLIT;
+
+    if (o->op_type != OP_SPLIT
+     || (o->op_flags & OPf_STACKED)
+     || !(o->op_private & OPpSPLIT_IMPLIM))
+	return FALSE;
+    pm = cPMOPx(cLISTOPo->op_first);
+    if (pm->op_type != OP_PUSHRE || (pm->op_flags & OPf_KIDS)
+     || pm->op_targ
+#ifdef USE_ITHREADS
+     || pm->op_pmreplrootu.op_pmtargetoff
+#else
+     || pm->op_pmreplrootu.op_pmtargetgv
+#endif
+    )
+	return FALSE;
+    limit = cLISTOPo->op_last;
+    if (limit->op_type != OP_CONST || SvIV(cSVOPx_sv(limit)) != 0)
+	return FALSE;
+    rx = PM_GETRE(pm);
+    if (!rx
+     || !(RX_EXTFLAGS(rx) & RXf_USE_INTUIT)
+     || !(RX_EXTFLAGS(rx) & RXf_CHECK_ALL)
+     || (RX_EXTFLAGS(rx) & (RXf_IS_ANCHORED|RXf_INTUIT_TAIL|RXf_START_ONLY
+			    |RXf_SKIPWHITE|RXf_WHITE|RXf_NULL|RXf_PMf_FOLD))
+     || RX_NPARENS(rx) || RX_MINLENRET(rx) != 1 || RX_UTF8(rx))
+	return FALSE;
+    csv = CALLREG_INTUIT_STRING(rx);
+    return csv && SvCUR(csv) == 1 && isASCII(*SvPVX_const(csv));
+}
+
 /*
 =for apidoc Am|OP *|newFOROP|I32 flags|OP *sv|OP *expr|OP *block|OP *cont
 
@@ -7499,6 +7543,11 @@ Perl_newFOROP(pTHX_ I32 flags, OP *sv, OP *expr, OP *block, OP *cont)
 	iterflags |= OPf_STACKED;
     }
     else {
+	/* for (split /,/, $x) walks the string; see pp_iter */
+	if (!(sv && sv->op_type == OP_NULL) && S_is_foreach_split(aTHX_ expr)) {
+	    expr->op_private |= OPpSPLIT_LAZY;
+	    iterpflags |= OPpITER_SPLIT;
+	}
         expr = op_lvalue(force_list(expr, 1), OP_GREPSTART);
     }
 
@@ -13765,6 +13814,60 @@ Perl_rpeep(pTHX_ OP *o)
 		}
 	    }
 
+	    /* (sort ...)[0..9] only needs the first ten elements sorted,
+	     * so if every index is a non-negative integer constant, let
+	     * pp_sort know it can pick those out and sort just them */
+	    for (oright = o->op_next;
+		 oright && oright->op_type == OP_NULL;
+		 oright = oright->op_next)
+		;
+	    if (!OpHAS_SIBLING(cUNOPo)
+		&& !(o->op_private & OPpSORT_REVERSE)
+		&& oright && oright->op_type == OP_LSLICE)
+	    {
+		OP * const lslice = oright;
+		OP * const list = cBINOPx(lslice)->op_last;
+		OP * const indices = cBINOPx(lslice)->op_first;
+		OP *kid;
+		bool ok = TRUE;
+
+		if (!(list->op_flags & OPf_KIDS)
+		    || OpSIBLING(cUNOPx(list)->op_first) != o
+		    || !(indices->op_flags & OPf_KIDS))
+		    break;
+		kid = OpSIBLING(cUNOPx(indices)->op_first);
+		if (!kid)
+		    break;
+		if (kid->op_type == OP_RV2AV && !OpHAS_SIBLING(kid)
+		    && cUNOPx(kid)->op_first->op_type == OP_CONST)
+		{
+		    /* a constant range, folded to an array */
+		    AV * const av = MUTABLE_AV(cSVOPx_sv(cUNOPx(kid)->op_first));
+		    SSize_t i;
+		    if (SvTYPE(av) != SVt_PVAV || AvFILLp(av) < 0)
+			break;
+		    for (i = 0; i <= AvFILLp(av); i++) {
+			SV * const sv = AvARRAY(av)[i];
+			if (!sv || !SvIOK(sv) || SvIsUV(sv) || SvIVX(sv) < 0)
+			    ok = FALSE;
+		    }
+		}
+		else {
+		    for (; kid; kid = OpSIBLING(kid)) {
+			SV *sv;
+			if (kid->op_type != OP_CONST) {
+			    ok = FALSE;
+			    break;
+			}
+			sv = cSVOPx_sv(kid);
+			if (!SvIOK(sv) || SvIsUV(sv) || SvIVX(sv) < 0)
+			    ok = FALSE;
+		    }
+		}
+		if (ok)
+		    o->op_private |= OPpSORT_TOPK;
+	    }
+
 	    break;
 	}
 
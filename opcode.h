@@ -2198,6 +2198,7 @@ END_EXTERN_C
 #define OPpDEREF_AV             0x10
 #define OPpEVAL_COPHH           0x10
 #define OPpFT_AFTER_t           0x10
+#define OPpITER_SPLIT           0x10
 #define OPpLVREF_AV             0x10
 #define OPpMAYBE_TRUEBOOL       0x10
 #define OPpMULTIDEREF_EXISTS    0x10
@@ -2214,6 +2215,7 @@ END_EXTERN_C
 #define OPpMULTIDEREF_DELETE    0x20
 #define OPpOPEN_IN_CRLF         0x20
 #define OPpSORT_QSORT           0x20
+#define OPpSPLIT_LAZY           0x20
 #define OPpTRANS_COMPLEMENT     0x20
 #define OPpTRUEBOOL             0x20
 #define OPpDEREF                0x30
@@ -2248,6 +2250,7 @@ END_EXTERN_C
 #define OPpOFFBYONE             0x80
 #define OPpOPEN_OUT_CRLF        0x80
 #define OPpPV_IS_UTF8           0x80
+#define OPpSORT_TOPK            0x80
 #define OPpSPLIT_IMPLIM         0x80
 #define OPpTRANS_DELETE         0x80
 START_EXTERN_C
@@ -2325,6 +2328,7 @@ EXTCONST char PL_op_private_labels[] = {
     'I','N','P','L','A','C','E','\0',
     'I','N','T','\0',
     'I','T','E','R','\0',
+    'L','A','Z','Y','\0',
     'L','I','N','E','N','U','M','\0',
     'L','V','\0',
     'L','V','D','E','F','E','R','\0',
@@ -2348,6 +2352,7 @@ EXTCONST char PL_op_private_labels[] = {
     'S','H','O','R','T','\0',
     'S','L','I','C','E','\0',
     'S','L','I','C','E','W','A','R','N','\0',
+    'S','P','L','I','T','\0',
     'S','Q','U','A','S','H','\0',
     'S','T','A','B','L','E','\0',
     'S','T','A','T','E','\0',
@@ -2356,6 +2361,7 @@ EXTCONST char PL_op_private_labels[] = {
     'S','V','\0',
     'T','A','R','G','\0',
     'T','A','R','G','M','Y','\0',
+    'T','O','P','K','\0',
     'U','N','I','\0',
     'U','T','F','\0',
 
@@ -2381,7 +2387,7 @@ EXTCONST I16 PL_op_private_bitfields[] = {
     0, 8, -1,
     0, 8, -1,
     4, -1, 1, 137, 2, 144, 3, 151, -1,
-    4, -1, 0, 495, 1, 26, 2, 264, 3, 83, -1,
+    4, -1, 0, 506, 1, 26, 2, 264, 3, 83, -1,
 
 };
 
@@ -2540,7 +2546,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       48, /* pack */
      123, /* split */
       48, /* join */
-     126, /* list */
+     127, /* list */
       12, /* lslice */
       48, /* anonlist */
       48, /* anonhash */
@@ -2549,48 +2555,48 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* pop */
        0, /* shift */
       79, /* unshift */
-     128, /* sort */
-     135, /* reverse */
-     137, /* grepstart */
-     138, /* grepwhile */
-     137, /* mapstart */
-     138, /* mapwhile */
+     129, /* sort */
+     137, /* reverse */
+     139, /* grepstart */
+     140, /* grepwhile */
+     139, /* mapstart */
+     140, /* mapwhile */
        0, /* range */
-     140, /* flip */
-     140, /* flop */
+     142, /* flip */
+     142, /* flop */
        0, /* and */
        0, /* or */
       12, /* xor */
        0, /* dor */
-     142, /* cond_expr */
+     144, /* cond_expr */
        0, /* andassign */
        0, /* orassign */
        0, /* dorassign */
        0, /* method */
-     144, /* entersub */
-     151, /* leavesub */
-     151, /* leavesublv */
-     153, /* caller */
+     146, /* entersub */
+     153, /* leavesub */
+     153, /* leavesublv */
+     155, /* caller */
       48, /* warn */
       48, /* die */
       48, /* reset */
       -1, /* lineseq */
-     155, /* nextstate */
-     155, /* dbstate */
+     157, /* nextstate */
+     157, /* dbstate */
       -1, /* unstack */
       -1, /* enter */
-     156, /* leave */
+     158, /* leave */
       -1, /* scope */
-     158, /* enteriter */
-     162, /* iter */
+     160, /* enteriter */
+     165, /* iter */
       -1, /* enterloop */
-     163, /* leaveloop */
+     166, /* leaveloop */
       -1, /* return */
-     165, /* last */
-     165, /* next */
-     165, /* redo */
-     165, /* dump */
-     165, /* goto */
+     168, /* last */
+     168, /* next */
+     168, /* redo */
+     168, /* dump */
+     168, /* goto */
       48, /* exit */
        0, /* method_named */
        0, /* method_super */
@@ -2602,7 +2608,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* leavewhen */
       -1, /* break */
       -1, /* continue */
-     167, /* open */
+     170, /* open */
       48, /* close */
       48, /* pipe_op */
       48, /* fileno */
@@ -2618,7 +2624,7 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
       48, /* getc */
       48, /* read */
       48, /* enterwrite */
-     151, /* leavewrite */
+     153, /* leavewrite */
       -1, /* prtf */
       -1, /* print */
       -1, /* say */
@@ -2648,33 +2654,33 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* getpeername */
        0, /* lstat */
        0, /* stat */
-     172, /* ftrread */
-     172, /* ftrwrite */
-     172, /* ftrexec */
-     172, /* fteread */
-     172, /* ftewrite */
-     172, /* fteexec */
-     177, /* ftis */
-     177, /* ftsize */
-     177, /* ftmtime */
-     177, /* ftatime */
-     177, /* ftctime */
-     177, /* ftrowned */
-     177, /* fteowned */
-     177, /* ftzero */
-     177, /* ftsock */
-     177, /* ftchr */
-     177, /* ftblk */
-     177, /* ftfile */
-     177, /* ftdir */
-     177, /* ftpipe */
-     177, /* ftsuid */
-     177, /* ftsgid */
-     177, /* ftsvtx */
-     177, /* ftlink */
-     177, /* fttty */
-     177, /* fttext */
-     177, /* ftbinary */
+     175, /* ftrread */
+     175, /* ftrwrite */
+     175, /* ftrexec */
+     175, /* fteread */
+     175, /* ftewrite */
+     175, /* fteexec */
+     180, /* ftis */
+     180, /* ftsize */
+     180, /* ftmtime */
+     180, /* ftatime */
+     180, /* ftctime */
+     180, /* ftrowned */
+     180, /* fteowned */
+     180, /* ftzero */
+     180, /* ftsock */
+     180, /* ftchr */
+     180, /* ftblk */
+     180, /* ftfile */
+     180, /* ftdir */
+     180, /* ftpipe */
+     180, /* ftsuid */
+     180, /* ftsgid */
+     180, /* ftsvtx */
+     180, /* ftlink */
+     180, /* fttty */
+     180, /* fttext */
+     180, /* ftbinary */
       79, /* chdir */
       79, /* chown */
       72, /* chroot */
@@ -2694,17 +2700,17 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* rewinddir */
        0, /* closedir */
       -1, /* fork */
-     181, /* wait */
+     184, /* wait */
       79, /* waitpid */
       79, /* system */
       79, /* exec */
       79, /* kill */
-     181, /* getppid */
+     184, /* getppid */
       79, /* getpgrp */
       79, /* setpgrp */
       79, /* getpriority */
       79, /* setpriority */
-     181, /* time */
+     184, /* time */
       -1, /* tms */
        0, /* localtime */
       48, /* gmtime */
@@ -2724,8 +2730,8 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* require */
        0, /* dofile */
       -1, /* hintseval */
-     182, /* entereval */
-     151, /* leaveeval */
+     185, /* entereval */
+     153, /* leaveeval */
        0, /* entertry */
       -1, /* leavetry */
        0, /* ghbyname */
@@ -2766,17 +2772,17 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
        0, /* reach */
       39, /* rkeys */
        0, /* rvalues */
-     188, /* coreargs */
+     191, /* coreargs */
        3, /* runcv */
        0, /* fc */
       -1, /* padcv */
       -1, /* introcv */
       -1, /* clonecv */
-     192, /* padrange */
-     194, /* refassign */
-     200, /* lvref */
-     206, /* lvrefslice */
-     207, /* lvavref */
+     195, /* padrange */
+     197, /* refassign */
+     203, /* lvref */
+     209, /* lvrefslice */
+     210, /* lvavref */
        0, /* anonconst */
 
 };
@@ -2797,70 +2803,70 @@ EXTCONST I16  PL_op_private_bitdef_ix[] = {
 
 EXTCONST U16  PL_op_private_bitdefs[] = {
     0x0003, /* scalar, prototype, refgen, srefgen, ref, readline, regcmaybe, regcreset, regcomp, chop, schop, defined, undef, study, preinc, i_preinc, predec, i_predec, postinc, i_postinc, postdec, i_postdec, negate, i_negate, not, ucfirst, lcfirst, uc, lc, quotemeta, aeach, akeys, avalues, each, values, pop, shift, range, and, or, dor, andassign, orassign, dorassign, method, method_named, method_super, method_redir, method_redir_super, entergiven, leavegiven, enterwhen, leavewhen, untie, tied, dbmclose, getsockname, getpeername, lstat, stat, readlink, readdir, telldir, rewinddir, closedir, localtime, alarm, require, dofile, entertry, ghbyname, gnbyname, gpbyname, shostent, snetent, sprotoent, sservent, gpwnam, gpwuid, ggrnam, ggrgid, lock, once, reach, rvalues, fc, anonconst */
-    0x29dc, 0x3bd9, /* pushmark */
+    0x2a7c, 0x3d39, /* pushmark */
     0x00bd, /* wantarray, runcv */
-    0x03b8, 0x1570, 0x3c8c, 0x3748, 0x2da5, /* const */
-    0x29dc, 0x2ef9, /* gvsv */
+    0x03b8, 0x1570, 0x3dec, 0x37e8, 0x2e45, /* const */
+    0x2a7c, 0x2f99, /* gvsv */
     0x13d5, /* gv */
     0x0067, /* gelem, lt, i_lt, gt, i_gt, le, i_le, ge, i_ge, eq, i_eq, ne, i_ne, ncmp, slt, sgt, sle, sge, seq, sne, bit_and, bit_xor, bit_or, smartmatch, lslice, xor */
-    0x29dc, 0x3bd8, 0x0257, /* padsv */
-    0x29dc, 0x3bd8, 0x2acc, 0x38c9, /* padav */
-    0x29dc, 0x3bd8, 0x0534, 0x05d0, 0x2acc, 0x38c9, /* padhv */
-    0x3699, /* pushre, qr */
-    0x29dc, 0x1758, 0x0256, 0x2acc, 0x2cc8, 0x3c84, 0x0003, /* rv2gv */
-    0x29dc, 0x2ef8, 0x0256, 0x3c84, 0x0003, /* rv2sv */
-    0x2acc, 0x0003, /* av2arylen, pos, keys, rkeys */
-    0x2c3c, 0x0b98, 0x08f4, 0x028c, 0x3e48, 0x3c84, 0x0003, /* rv2cv */
+    0x2a7c, 0x3d38, 0x0257, /* padsv */
+    0x2a7c, 0x3d38, 0x2b6c, 0x3969, /* padav */
+    0x2a7c, 0x3d38, 0x0534, 0x05d0, 0x2b6c, 0x3969, /* padhv */
+    0x3739, /* pushre, qr */
+    0x2a7c, 0x1758, 0x0256, 0x2b6c, 0x2d68, 0x3de4, 0x0003, /* rv2gv */
+    0x2a7c, 0x2f98, 0x0256, 0x3de4, 0x0003, /* rv2sv */
+    0x2b6c, 0x0003, /* av2arylen, pos, keys, rkeys */
+    0x2cdc, 0x0b98, 0x08f4, 0x028c, 0x3fa8, 0x3de4, 0x0003, /* rv2cv */
     0x012f, /* bless, glob, sprintf, formline, unpack, pack, join, anonlist, anonhash, splice, warn, die, reset, exit, close, pipe_op, fileno, umask, binmode, tie, dbmopen, sselect, select, getc, read, enterwrite, sysopen, sysseek, sysread, syswrite, eof, tell, seek, truncate, fcntl, ioctl, send, recv, socket, sockpair, bind, connect, listen, accept, shutdown, gsockopt, ssockopt, open_dir, seekdir, gmtime, shmget, shmctl, shmread, shmwrite, msgget, msgctl, msgsnd, msgrcv, semop, semget, semctl, ghbyaddr, gnbyaddr, gpbynumber, gsbyname, gsbyport, syscall */
-    0x30dc, 0x2ff8, 0x24b4, 0x23f0, 0x0003, /* backtick */
-    0x3698, 0x3ef1, /* match, subst */
-    0x3698, 0x0003, /* substcont */
-    0x0c9c, 0x1dd8, 0x0834, 0x3ef0, 0x3a0c, 0x2168, 0x01e4, 0x0141, /* trans, transr */
+    0x317c, 0x3098, 0x24b4, 0x23f0, 0x0003, /* backtick */
+    0x3738, 0x4051, /* match, subst */
+    0x3738, 0x0003, /* substcont */
+    0x0c9c, 0x1dd8, 0x0834, 0x4050, 0x3b6c, 0x2168, 0x01e4, 0x0141, /* trans, transr */
     0x0adc, 0x0458, 0x0067, /* sassign */
-    0x0758, 0x2acc, 0x0067, /* aassign */
-    0x3ef0, 0x0003, /* chomp, schomp, complement, sin, cos, exp, log, sqrt, int, hex, oct, abs, length, ord, chr, chroot, rmdir */
-    0x3ef0, 0x0067, /* pow, multiply, i_multiply, divide, i_divide, modulo, i_modulo, add, i_add, subtract, i_subtract, concat, left_shift, right_shift, i_ncmp, scmp */
-    0x1058, 0x3ef0, 0x0067, /* repeat */
-    0x3ef0, 0x012f, /* stringify, atan2, rand, srand, index, rindex, crypt, push, unshift, flock, chdir, chown, unlink, chmod, utime, rename, link, symlink, mkdir, waitpid, system, exec, kill, getpgrp, setpgrp, getpriority, setpriority, sleep */
-    0x33f0, 0x2acc, 0x00cb, /* substr */
-    0x3ef0, 0x2acc, 0x0067, /* vec */
-    0x29dc, 0x2ef8, 0x2acc, 0x38c8, 0x3c84, 0x0003, /* rv2av */
+    0x0758, 0x2b6c, 0x0067, /* aassign */
+    0x4050, 0x0003, /* chomp, schomp, complement, sin, cos, exp, log, sqrt, int, hex, oct, abs, length, ord, chr, chroot, rmdir */
+    0x4050, 0x0067, /* pow, multiply, i_multiply, divide, i_divide, modulo, i_modulo, add, i_add, subtract, i_subtract, concat, left_shift, right_shift, i_ncmp, scmp */
+    0x1058, 0x4050, 0x0067, /* repeat */
+    0x4050, 0x012f, /* stringify, atan2, rand, srand, index, rindex, crypt, push, unshift, flock, chdir, chown, unlink, chmod, utime, rename, link, symlink, mkdir, waitpid, system, exec, kill, getpgrp, setpgrp, getpriority, setpriority, sleep */
+    0x3490, 0x2b6c, 0x00cb, /* substr */
+    0x4050, 0x2b6c, 0x0067, /* vec */
+    0x2a7c, 0x2f98, 0x2b6c, 0x3968, 0x3de4, 0x0003, /* rv2av */
     0x01ff, /* aelemfast, aelemfast_lex */
-    0x29dc, 0x28d8, 0x0256, 0x2acc, 0x0067, /* aelem, helem */
-    0x29dc, 0x2acc, 0x38c9, /* aslice, hslice */
-    0x2acd, /* kvaslice, kvhslice */
-    0x29dc, 0x3818, 0x0003, /* delete */
-    0x3d78, 0x0003, /* exists */
-    0x29dc, 0x2ef8, 0x0534, 0x05d0, 0x2acc, 0x38c8, 0x3c84, 0x0003, /* rv2hv */
-    0x29dc, 0x28d8, 0x0d14, 0x1670, 0x2acc, 0x3c84, 0x0003, /* multideref */
-    0x223c, 0x2ef8, 0x3ef1, /* split */
-    0x29dc, 0x1e99, /* list */
-    0x3af8, 0x3194, 0x0fb0, 0x254c, 0x34e8, 0x2644, 0x2e61, /* sort */
+    0x2a7c, 0x2978, 0x0256, 0x2b6c, 0x0067, /* aelem, helem */
+    0x2a7c, 0x2b6c, 0x3969, /* aslice, hslice */
+    0x2b6d, /* kvaslice, kvhslice */
+    0x2a7c, 0x38b8, 0x0003, /* delete */
+    0x3ed8, 0x0003, /* exists */
+    0x2a7c, 0x2f98, 0x0534, 0x05d0, 0x2b6c, 0x3968, 0x3de4, 0x0003, /* rv2hv */
+    0x2a7c, 0x2978, 0x0d14, 0x1670, 0x2b6c, 0x3de4, 0x0003, /* multideref */
+    0x223c, 0x2f98, 0x2774, 0x4051, /* split */
+    0x2a7c, 0x1e99, /* list */
+    0x413c, 0x3c58, 0x3234, 0x0fb0, 0x254c, 0x3588, 0x2644, 0x2f01, /* sort */
     0x254c, 0x0003, /* reverse */
     0x1cc5, /* grepstart, mapstart */
     0x1cc4, 0x0003, /* grepwhile, mapwhile */
-    0x2778, 0x0003, /* flip, flop */
-    0x29dc, 0x0003, /* cond_expr */
-    0x29dc, 0x0b98, 0x0256, 0x028c, 0x3e48, 0x3c84, 0x2301, /* entersub */
-    0x3258, 0x0003, /* leavesub, leavesublv, leavewrite, leaveeval */
+    0x2818, 0x0003, /* flip, flop */
+    0x2a7c, 0x0003, /* cond_expr */
+    0x2a7c, 0x0b98, 0x0256, 0x028c, 0x3fa8, 0x3de4, 0x2301, /* entersub */
+    0x32f8, 0x0003, /* leavesub, leavesublv, leavewrite, leaveeval */
     0x00bc, 0x012f, /* caller */
     0x2075, /* nextstate, dbstate */
-    0x287c, 0x3259, /* leave */
-    0x29dc, 0x2ef8, 0x0c0c, 0x3569, /* enteriter */
-    0x3569, /* iter */
-    0x287c, 0x0067, /* leaveloop */
-    0x405c, 0x0003, /* last, next, redo, dump, goto */
-    0x30dc, 0x2ff8, 0x24b4, 0x23f0, 0x012f, /* open */
+    0x291c, 0x32f9, /* leave */
+    0x2a7c, 0x2f98, 0x3ab0, 0x0c0c, 0x3609, /* enteriter */
+    0x3609, /* iter */
+    0x291c, 0x0067, /* leaveloop */
+    0x425c, 0x0003, /* last, next, redo, dump, goto */
+    0x317c, 0x3098, 0x24b4, 0x23f0, 0x012f, /* open */
     0x1910, 0x1b6c, 0x1a28, 0x17e4, 0x0003, /* ftrread, ftrwrite, ftrexec, fteread, ftewrite, fteexec */
     0x1910, 0x1b6c, 0x1a28, 0x0003, /* ftis, ftsize, ftmtime, ftatime, ftctime, ftrowned, fteowned, ftzero, ftsock, ftchr, ftblk, ftfile, ftdir, ftpipe, ftsuid, ftsgid, ftsvtx, ftlink, fttty, fttext, ftbinary */
-    0x3ef1, /* wait, getppid, time */
-    0x32f4, 0x09b0, 0x068c, 0x3fc8, 0x1f84, 0x0003, /* entereval */
-    0x2b9c, 0x0018, 0x0ec4, 0x0de1, /* coreargs */
-    0x29dc, 0x019b, /* padrange */
-    0x29dc, 0x3bd8, 0x0376, 0x26cc, 0x14c8, 0x0067, /* refassign */
-    0x29dc, 0x3bd8, 0x0376, 0x26cc, 0x14c8, 0x0003, /* lvref */
-    0x29dd, /* lvrefslice */
-    0x29dc, 0x3bd8, 0x0003, /* lvavref */
+    0x4051, /* wait, getppid, time */
+    0x3394, 0x09b0, 0x068c, 0x41c8, 0x1f84, 0x0003, /* entereval */
+    0x2c3c, 0x0018, 0x0ec4, 0x0de1, /* coreargs */
+    0x2a7c, 0x019b, /* padrange */
+    0x2a7c, 0x3d38, 0x0376, 0x26cc, 0x14c8, 0x0067, /* refassign */
+    0x2a7c, 0x3d38, 0x0376, 0x26cc, 0x14c8, 0x0003, /* lvref */
+    0x2a7d, /* lvrefslice */
+    0x2a7c, 0x3d38, 0x0003, /* lvavref */
 
 };
 
@@ -3017,7 +3023,7 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* MULTIDEREF */ (OPpARG1_MASK|OPpHINT_STRICT_REFS|OPpMAYBE_LVSUB|OPpMULTIDEREF_EXISTS|OPpMULTIDEREF_DELETE|OPpLVAL_DEFER|OPpLVAL_INTRO),
     /* UNPACK     */ (OPpARG4_MASK),
     /* PACK       */ (OPpARG4_MASK),
-    /* SPLIT      */ (OPpTARGET_MY|OPpOUR_INTRO|OPpSPLIT_IMPLIM),
+    /* SPLIT      */ (OPpTARGET_MY|OPpSPLIT_LAZY|OPpOUR_INTRO|OPpSPLIT_IMPLIM),
     /* JOIN       */ (OPpARG4_MASK),
     /* LIST       */ (OPpLIST_GUESSED|OPpLVAL_INTRO),
     /* LSLICE     */ (OPpARG2_MASK),
@@ -3028,7 +3034,7 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* POP        */ (OPpARG1_MASK),
     /* SHIFT      */ (OPpARG1_MASK),
     /* UNSHIFT    */ (OPpARG4_MASK|OPpTARGET_MY),
-    /* SORT       */ (OPpSORT_NUMERIC|OPpSORT_INTEGER|OPpSORT_REVERSE|OPpSORT_INPLACE|OPpSORT_DESCEND|OPpSORT_QSORT|OPpSORT_STABLE),
+    /* SORT       */ (OPpSORT_NUMERIC|OPpSORT_INTEGER|OPpSORT_REVERSE|OPpSORT_INPLACE|OPpSORT_DESCEND|OPpSORT_QSORT|OPpSORT_STABLE|OPpSORT_TOPK),
     /* REVERSE    */ (OPpARG1_MASK|OPpREVERSE_INPLACE),
     /* GREPSTART  */ (OPpGREP_LEX),
     /* GREPWHILE  */ (OPpARG1_MASK|OPpGREP_LEX),
@@ -3060,7 +3066,7 @@ EXTCONST U8 PL_op_private_valid[] = {
     /* ENTER      */ (0),
     /* LEAVE      */ (OPpREFCOUNTED|OPpLVALUE),
     /* SCOPE      */ (0),
-    /* ENTERITER  */ (OPpITER_REVERSED|OPpITER_DEF|OPpOUR_INTRO|OPpLVAL_INTRO),
+    /* ENTERITER  */ (OPpITER_REVERSED|OPpITER_DEF|OPpITER_SPLIT|OPpOUR_INTRO|OPpLVAL_INTRO),
     /* ITER       */ (OPpITER_REVERSED),
     /* ENTERLOOP  */ (0),
     /* LEAVELOOP  */ (OPpARG2_MASK|OPpLVALUE),
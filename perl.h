@@ -6312,6 +6312,16 @@ extern void moncontrol(int);
 
 #define PERL_MAGIC_UTF8_CACHESIZE	2
 
+/* Long UTF-8 strings that see offset lookups far from any cached position
+ * also get a sampled index, holding the byte offset of every
+ * PERL_UTF8_INDEX_STRIDE'th character, after the cache pairs */
+#ifndef PERL_UTF8_INDEX_STRIDE
+#  define PERL_UTF8_INDEX_STRIDE	1024
+#endif
+#ifndef PERL_UTF8_INDEX_MIN
+#  define PERL_UTF8_INDEX_MIN		(32 * PERL_UTF8_INDEX_STRIDE)
+#endif
+
 #define PERL_UNICODE_STDIN_FLAG			0x0001
 #define PERL_UNICODE_STDOUT_FLAG		0x0002
 #define PERL_UNICODE_STDERR_FLAG		0x0004
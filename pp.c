@@ -5572,6 +5572,25 @@ PP(pp_split)
     TAINT_IF(get_regex_charset(RX_EXTFLAGS(rx)) == REGEX_LOCALE_CHARSET &&
              (RX_EXTFLAGS(rx) & (RXf_WHITE | RXf_SKIPWHITE)));
 
+    if (PL_op->op_private & OPpSPLIT_LAZY) {
+	/* We are the list of a foreach, which will cut the fields out of
+	 * a copy of the string as it goes round (see pp_iter) rather than
+	 * have them all made now.  The separator is a single ASCII byte;
+	 * trailing separators would only give trailing empty fields, which
+	 * are dropped, so leave them off the copy.  pp_enteriter takes the
+	 * copy and the separator off the stack. */
+	SV * const sep = CALLREG_INTUIT_STRING(rx);
+	const char c = *SvPVX_const(sep);
+	assert(!ary);
+	while (strend > s && strend[-1] == c)
+	    strend--;
+	EXTEND(SP, 2);
+	PUSHs(newSVpvn_flags(s, strend - s,
+			     (do_utf8 ? SVf_UTF8 : 0) | SVs_TEMP));
+	PUSHs(sep);
+	RETURN;
+    }
+
 #ifdef USE_ITHREADS
     if (pm->op_pmreplrootu.op_pmtargetoff) {
 	ary = GvAVn(MUTABLE_GV(PAD_SVl(pm->op_pmreplrootu.op_pmtargetoff)));
@@ -5783,9 +5802,8 @@ PP(pp_split)
 	if (len == 1 && !RX_UTF8(rx) && !tail) {
 	    const char c = *SvPV_nolen_const(csv);
 	    while (--limit) {
-		for (m = s; m < strend && *m != c; m++)
-		    ;
-		if (m >= strend)
+		m = (const char *)memchr(s, c, strend - s);
+		if (!m)
 		    break;
 		if (gimme_scalar) {
 		    iters++;
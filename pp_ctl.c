@@ -2156,6 +2156,8 @@ PP(pp_enteriter)
 
     if (PL_op->op_private & OPpITER_DEF)
 	cxtype |= CXp_FOR_DEF;
+    if (PL_op->op_private & OPpITER_SPLIT)
+	cxtype |= CXp_FOR_SPLIT;
 
     ENTER_with_name("loop2");
 
@@ -2216,6 +2218,15 @@ PP(pp_enteriter)
 		-1;
 	}
     }
+    else if (cxtype & CXp_FOR_SPLIT) {
+	/* pp_split has left us the string its fields are to be cut from,
+	 * and the separator */
+	SV * const sep = POPs;
+	SV * const str = POPs;
+	cx->blk_loop.state_u.lazysplit.str = SvREFCNT_inc_simple_NN(str);
+	cx->blk_loop.state_u.lazysplit.off = SvCUR(str) ? 0 : 1;
+	cx->blk_loop.state_u.lazysplit.sep = *SvPVX_const(sep);
+    }
     else { /* iterating over items on the stack */
 	cx->blk_loop.state_u.ary.ary = NULL; /* means to use the stack */
 	if (PL_op->op_private & OPpITER_REVERSED) {
@@ -2368,11 +2368,50 @@ PP(pp_iter)
     case CXt_LOOP_FOR: /* iterate array */
     {
 
-        AV *av = cx->blk_loop.state_u.ary.ary;
+        AV *av;
         SV *sv;
         bool av_is_stack = FALSE;
         IV ix;
 
+        if (UNLIKELY(cx->cx_type & CXp_FOR_SPLIT)) {
+            /* for (split /,/, $x): cut the next field out of pp_split's
+             * copy of the string */
+            SV * const str = cx->blk_loop.state_u.lazysplit.str;
+            const char * const pv = SvPVX_const(str);
+            const STRLEN len = SvCUR(str);
+            const STRLEN off = cx->blk_loop.state_u.lazysplit.off;
+            const char *m;
+            STRLEN end;
+
+            if (UNLIKELY(off > len))
+                RETPUSHNO;
+            m = (const char *)memchr(pv + off,
+                                     cx->blk_loop.state_u.lazysplit.sep,
+                                     len - off);
+            end = m ? (STRLEN)(m - pv) : len;
+            cx->blk_loop.state_u.lazysplit.off = end + 1;
+
+            oldsv = *itersvp;
+            if (LIKELY(oldsv && SvREFCNT(oldsv) == 1 && !SvMAGICAL(oldsv))) {
+                /* safe to reuse old SV */
+                sv_setpvn(oldsv, pv + off, end - off);
+                sv = oldsv;
+            }
+            else {
+                /* a fresh SV, as for the lazy ranges above */
+                sv = *itersvp = newSVpvn(pv + off, end - off);
+                SvREFCNT_dec(oldsv);
+            }
+            if (SvUTF8(str))
+                SvUTF8_on(sv);
+            else
+                SvUTF8_off(sv);
+            if (SvTAINTED(str))
+                SvTAINTED_on(sv);
+            break;
+        }
+
+        av = cx->blk_loop.state_u.ary.ary;
         if (!av) {
             av_is_stack = TRUE;
             av = PL_curstack;
@@ -2763,8 +2802,14 @@ PP(pp_subst)
 	    rxtainted |= SUBST_TAINT_PAT;
 	repl = dstr;
         s = RX_OFFS(rx)[0].start + orig;
-	dstr = newSVpvn_flags(orig, s-orig,
-                    SVs_TEMP | (DO_UTF8(TARG) ? SVf_UTF8 : 0));
+	/* The result is built up by appending to dstr, here and in
+	 * pp_substcont.  It usually ends up close to the length of the
+	 * original, so allocate that much up front rather than letting
+	 * each append grow the buffer a little at a time */
+	dstr = sv_2mortal(newSV(len + (c ? clen : 0)));
+	sv_setpvn(dstr, orig, s-orig);
+	if (DO_UTF8(TARG))
+	    SvUTF8_on(dstr);
 	if (!c) {
 	    PERL_CONTEXT *cx;
 	    SPAGAIN;
@@ -1468,6 +1468,611 @@ Perl_sortsv_flags(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
 #define SvSIOK(sv) ((SvFLAGS(sv) & (SVf_IOK|SVf_IVisUV)) == SVf_IOK)
 #define SvNSIV(sv) ( SvNOK(sv) ? SvNVX(sv) : ( SvSIOK(sv) ? SvIVX(sv) : sv_2nv(sv) ) )
 
+/* Radix sort, used in place of the mergesort for large lists of plain
+ * numbers or strings sorted with the built-in comparisons.  Each element
+ * gets a key which orders the same way as the comparison function would,
+ * and is computed once up front; anything for which that can't be done
+ * without side effects (get magic, NaNs, strings of differing UTF-8ness)
+ * makes us give up before anything has been moved, and the caller then
+ * falls back to the comparison sort.  Both radix sorts are stable, so the
+ * result is identical to mergesort's.
+ */
+
+#ifndef RADIXSORT_MIN
+#define RADIXSORT_MIN (64)		/* below this mergesort wins */
+#endif
+#define RADIXSORT_STR_SMALL (16)	/* insertion sort buckets this small */
+
+#define RADIX_SIGN_BIT	((UV)1 << (UVSIZE * 8 - 1))
+#define RADIX_IV_KEY(iv) ((UV)(iv) ^ RADIX_SIGN_BIT)
+
+/* The NV keys are the bits of the NV with negatives inverted, which needs
+ * NVs to be IEEE doubles the same size as a UV */
+#if NVSIZE == UVSIZE && NVSIZE == 8 && !defined(USE_LONG_DOUBLE) \
+ && !defined(USE_QUADMATH)
+#  define RADIXSORT_NV
+#endif
+
+typedef struct {
+    UV	key;
+    SV	*sv;
+} radix_num;
+
+typedef struct {
+    const U8	*pv;
+    STRLEN	len;
+    SV		*sv;
+} radix_str;
+
+#ifdef RADIXSORT_NV
+STATIC UV
+S_radix_nv_key(NV nv)
+{
+    UV key;
+
+    if (nv == 0.0)
+	nv = 0.0;	/* -0.0 compares equal to 0.0 */
+    Copy(&nv, &key, 1, UV);
+    return (key & RADIX_SIGN_BIT) ? ~key : key | RADIX_SIGN_BIT;
+}
+#endif
+
+/* LSD radix sort of the nmemb entries in list, which is followed by room
+ * for as many again.  Small lists are done a byte at a time; big ones in
+ * RADIX_WIDE_BITS digits, which takes fewer passes over the list at the
+ * cost of counting tables which only pay their way when the list is much
+ * bigger than they are.  Passes on digits which are the same in every key
+ * are skipped.  Returns whichever half ends up sorted. */
+
+#ifndef RADIX_WIDE_BITS
+#define RADIX_WIDE_BITS (11)
+#endif
+#ifndef RADIX_WIDE_MIN
+#define RADIX_WIDE_MIN  (1 << 16)	/* use wide digits from this many */
+#endif
+
+STATIC radix_num *
+S_radixsort_num_list(radix_num *list, size_t nmemb)
+{
+    radix_num *from = list;
+    radix_num *to = list + nmemb;
+    const unsigned int bits = nmemb >= RADIX_WIDE_MIN ? RADIX_WIDE_BITS : 8;
+    const unsigned int passes = (UVSIZE * 8 + bits - 1) / bits;
+    const size_t buckets = (size_t)1 << bits;
+    const UV mask = buckets - 1;
+    size_t *count;
+    size_t i;
+    unsigned int pass;
+
+    Newxz(count, passes * buckets, size_t);
+    for (i = 0; i < nmemb; i++) {
+	UV key = list[i].key;
+	for (pass = 0; pass < passes; pass++) {
+	    count[pass * buckets + (key & mask)]++;
+	    key >>= bits;
+	}
+    }
+
+    for (pass = 0; pass < passes; pass++) {
+	size_t * const c = count + pass * buckets;
+	const unsigned int shift = pass * bits;
+	size_t sum = 0;
+	size_t j;
+	radix_num *tmp;
+
+	if (c[(from[0].key >> shift) & mask] == nmemb)
+	    continue;
+	for (j = 0; j < buckets; j++) {
+	    const size_t n = c[j];
+	    c[j] = sum;
+	    sum += n;
+	}
+	for (i = 0; i < nmemb; i++)
+	    to[c[(from[i].key >> shift) & mask]++] = from[i];
+	tmp = from;
+	from = to;
+	to = tmp;
+    }
+
+    Safefree(count);
+    return from;
+}
+
+/* Radix sort on IVs (is_iv) or on the values S_sv_ncmp() compares */
+
+STATIC bool
+S_radixsort_num(SV **array, size_t nmemb, bool is_iv, U32 flags)
+{
+    radix_num *list, *sorted;
+    size_t i;
+
+    Newx(list, 2 * nmemb, radix_num);
+    for (i = 0; i < nmemb; i++) {
+	SV * const sv = array[i];
+	UV key;
+
+	if (SvGMAGICAL(sv))
+	    goto give_up;
+	if (is_iv) {
+	    if (!SvIOK(sv))
+		goto give_up;
+	    key = RADIX_IV_KEY(SvIVX(sv));
+	}
+	else {
+#ifdef RADIXSORT_NV
+	    NV nv;
+	    if (SvNOK(sv))
+		nv = SvNVX(sv);
+	    else if (SvSIOK(sv))
+		nv = (NV)SvIVX(sv);
+	    else
+		goto give_up;
+	    if (Perl_isnan(nv))
+		goto give_up;	/* they don't sort, and the comparison warns */
+	    key = S_radix_nv_key(nv);
+#else
+	    goto give_up;
+#endif
+	}
+	if (flags & SORTf_DESC)
+	    key = ~key;
+	list[i].key = key;
+	list[i].sv = sv;
+    }
+
+    sorted = S_radixsort_num_list(list, nmemb);
+    for (i = 0; i < nmemb; i++)
+	array[i] = sorted[i].sv;
+    Safefree(list);
+    return TRUE;
+
+  give_up:
+    Safefree(list);
+    return FALSE;
+}
+
+/* Compare two strings known to be equal in their first depth bytes, the
+ * way sv_cmp() does */
+
+STATIC int
+S_radix_str_cmp(const radix_str *a, const radix_str *b, STRLEN depth)
+{
+    const STRLEN la = a->len - depth;
+    const STRLEN lb = b->len - depth;
+    const int retval = memcmp(a->pv + depth, b->pv + depth, la < lb ? la : lb);
+
+    if (retval)
+	return retval;
+    return la < lb ? -1 : la > lb;
+}
+
+/* Stable MSD radix sort of strings which all agree in their first depth
+ * bytes.  Strings ending at depth go first, then one bucket per next byte.
+ * The largest bucket is done by going round the loop again rather than by
+ * recursing, so the recursion is at most log2(nmemb) deep. */
+
+STATIC void
+S_radixsort_str_part(radix_str *list, radix_str *aux, size_t nmemb,
+		     STRLEN depth)
+{
+    size_t end[257];
+
+    for (;;) {
+	size_t i, start, big, bigsize;
+	unsigned int j;
+
+	if (nmemb <= RADIXSORT_STR_SMALL) {
+	    for (i = 1; i < nmemb; i++) {
+		const radix_str tmp = list[i];
+		size_t k = i;
+		while (k && S_radix_str_cmp(&list[k - 1], &tmp, depth) > 0) {
+		    list[k] = list[k - 1];
+		    k--;
+		}
+		list[k] = tmp;
+	    }
+	    return;
+	}
+
+#define RADIX_BUCKET(e) ((e).len > depth ? (e).pv[depth] + 1 : 0)
+	Zero(end, 257, size_t);
+	for (i = 0; i < nmemb; i++)
+	    end[RADIX_BUCKET(list[i])]++;
+
+	j = RADIX_BUCKET(list[0]);
+	if (end[j] == nmemb) {
+	    /* nothing to distribute on this byte */
+	    if (j == 0)
+		return;		/* all the same string */
+	    depth++;
+	    continue;
+	}
+
+	for (start = 0, j = 0; j < 257; j++) {
+	    start += end[j];
+	    end[j] = start - end[j];	/* start of the bucket, for now */
+	}
+	for (i = 0; i < nmemb; i++)
+	    aux[end[RADIX_BUCKET(list[i])]++] = list[i];
+	Copy(aux, list, nmemb, radix_str);
+#undef RADIX_BUCKET
+
+	/* end[j] is now the end of bucket j; bucket 0 is already done */
+	big = 0;
+	bigsize = 0;
+	for (j = 1; j < 257; j++) {
+	    const size_t size = end[j] - end[j - 1];
+	    if (size > bigsize) {
+		big = j;
+		bigsize = size;
+	    }
+	}
+	for (j = 1; j < 257; j++) {
+	    const size_t size = end[j] - end[j - 1];
+	    if (j != big && size > 1)
+		S_radixsort_str_part(list + end[j - 1], aux, size, depth + 1);
+	}
+	list += end[big - 1];
+	nmemb = bigsize;
+	depth++;
+    }
+}
+
+/* Sort array by the strings in keys, which may be array itself.  A stable
+ * descending sort is the reverse of a stable ascending sort of the
+ * reversed list. */
+
+STATIC bool
+S_radixsort_str(SV **array, SV **keys, size_t nmemb, U32 flags)
+{
+    radix_str *list;
+    const bool desc = cBOOL(flags & SORTf_DESC);
+    const U32 utf8 = SvUTF8(keys[0]);
+    size_t i;
+
+    Newx(list, 2 * nmemb, radix_str);
+    for (i = 0; i < nmemb; i++) {
+	const size_t j = desc ? nmemb - 1 - i : i;
+	SV * const sv = keys[j];
+
+	/* sv_cmp() of a UTF-8 and a byte string isn't a memcmp() */
+	if (SvGMAGICAL(sv) || !SvPOK(sv) || SvUTF8(sv) != utf8) {
+	    Safefree(list);
+	    return FALSE;
+	}
+	list[i].pv = (const U8 *)SvPVX_const(sv);
+	list[i].len = SvCUR(sv);
+	list[i].sv = array[j];
+    }
+
+    S_radixsort_str_part(list, list + nmemb, nmemb, 0);
+
+    for (i = 0; i < nmemb; i++)
+	array[desc ? nmemb - 1 - i : i] = list[i].sv;
+    Safefree(list);
+    return TRUE;
+}
+
+/* Returns true if it has sorted the array, which it only tries to do for
+ * the comparison functions pp_sort() uses for plain <=> and cmp */
+
+STATIC bool
+S_radixsortsv(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
+{
+    PERL_UNUSED_CONTEXT;
+
+    if (nmemb < RADIXSORT_MIN)
+	return FALSE;
+    if (cmp == S_sv_i_ncmp || cmp == S_sv_ncmp)
+	return S_radixsort_num(array, nmemb, cmp == S_sv_i_ncmp, flags);
+    if (cmp == (SVCOMPARE_t)sv_cmp_static)
+	return S_radixsort_str(array, array, nmemb, flags);
+    return FALSE;
+}
+
+/* Keyed sorts.  A sort block which just compares the same hash or array
+ * element of $a and $b, such as
+ *
+ *     sort { $a->{name} cmp $b->{name} } @records
+ *     sort { $b->[2] <=> $a->[2] } @rows
+ *
+ * compiles to two multideref ops feeding an ncmp, i_ncmp or scmp.  Rather
+ * than run that for every comparison, fetch each element's key once and
+ * radix sort on the keys.  As with the plain radix sorts, anything which
+ * would make the block do more than look the keys up and compare them
+ * (magic, overloading, non-references, missing or undefined keys, keys
+ * which don't numify cleanly, NaNs, locale) makes us return false before
+ * anything has moved, and the block is run as usual. */
+
+STATIC bool
+S_sortkeyedsv(pTHX_ SV **array, size_t nmemb, U32 flags)
+{
+    const OP * const o1 = PL_sortcop;
+    const OP *o2, *cmpop;
+    UNOP_AUX_item *items1, *items2;
+    UV action;
+    GV *gv1, *gv2, *gva, *gvb;
+    SV *hkey = NULL;
+    IV index = 0;
+    SV **keys;
+    size_t i;
+    bool sorted = FALSE;
+
+    if (o1->op_type != OP_MULTIDEREF
+	|| !(o2 = o1->op_next) || o2->op_type != OP_MULTIDEREF
+	|| !(cmpop = o2->op_next) || cmpop->op_next
+	|| ((o1->op_private | o2->op_private)
+	    & (OPpMAYBE_LVSUB|OPpMULTIDEREF_EXISTS|OPpMULTIDEREF_DELETE
+	       |OPpLVAL_DEFER|OPpLVAL_INTRO)))
+	return FALSE;
+    switch (cmpop->op_type) {
+    case OP_SCMP:
+#ifdef USE_LOCALE_COLLATE
+	if (IN_LC_RUNTIME(LC_COLLATE))
+	    return FALSE;
+#endif
+	/* FALLTHROUGH */
+    case OP_NCMP:
+    case OP_I_NCMP:
+	break;
+    default:
+	return FALSE;
+    }
+
+    /* both must be $pkgvar->{CONST} or $pkgvar->[CONST], the same one */
+    items1 = cUNOP_AUXx(o1)->op_aux;
+    items2 = cUNOP_AUXx(o2)->op_aux;
+    action = items1[0].uv;
+    if (action != items2[0].uv)
+	return FALSE;
+    if (action == (MDEREF_HV_gvsv_vivify_rv2hv_helem
+		   |MDEREF_INDEX_const|MDEREF_FLAG_last))
+    {
+	SV *hkey2;
+	hkey = UNOP_AUX_item_sv(&items1[2]);
+	hkey2 = UNOP_AUX_item_sv(&items2[2]);
+	if (!sv_eq_flags(hkey, hkey2, 0))
+	    return FALSE;
+    }
+    else if (action == (MDEREF_AV_gvsv_vivify_rv2av_aelem
+			|MDEREF_INDEX_const|MDEREF_FLAG_last))
+    {
+	index = items1[2].iv;
+	if (index != items2[2].iv)
+	    return FALSE;
+    }
+    else
+	return FALSE;
+
+    gv1 = (GV *)UNOP_AUX_item_sv(&items1[1]);
+    gv2 = (GV *)UNOP_AUX_item_sv(&items2[1]);
+    gva = gv_fetchpvs("a", GV_ADD|GV_NOTQUAL, SVt_PV);
+    gvb = gv_fetchpvs("b", GV_ADD|GV_NOTQUAL, SVt_PV);
+    if (gv1 == gvb && gv2 == gva)
+	flags ^= SORTf_DESC;
+    else if (gv1 != gva || gv2 != gvb)
+	return FALSE;
+
+    Newx(keys, nmemb, SV *);
+    SAVEFREEPV(keys);
+    for (i = 0; i < nmemb; i++) {
+	SV * const sv = array[i];
+	SV *target;
+	SV *key;
+
+	if (SvGMAGICAL(sv) || !SvROK(sv) || SvAMAGIC(sv))
+	    goto done;
+	target = SvRV(sv);
+	if (SvRMAGICAL(target))
+	    goto done;
+	if (hkey) {
+	    HE *he;
+	    if (SvTYPE(target) != SVt_PVHV
+		|| !(he = hv_fetch_ent(MUTABLE_HV(target), hkey, 0, 0)))
+		goto done;
+	    key = HeVAL(he);
+	}
+	else {
+	    SV **svp;
+	    if (SvTYPE(target) != SVt_PVAV
+		|| !(svp = av_fetch(MUTABLE_AV(target), index, 0)))
+		goto done;
+	    key = *svp;
+	}
+	if (SvGMAGICAL(key) || SvROK(key))
+	    goto done;
+	keys[i] = key;
+    }
+
+    if (cmpop->op_type == OP_SCMP) {
+	sorted = S_radixsort_str(array, keys, nmemb, flags);
+    }
+    else {
+	/* Numify the keys the way the comparison would, then check that
+	   we can key on IVs (as i_ncmp always does, and as ncmp does when
+	   both sides are IVs) or failing that NVs, without changing the
+	   order of any pair */
+	const bool integer = cmpop->op_type == OP_I_NCMP;
+	bool all_iv = TRUE;
+	bool big_iv = FALSE;
+	radix_num *list;
+
+	for (i = 0; i < nmemb; i++) {
+	    SV * const key = keys[i];
+	    if (!(SvFLAGS(key) & (SVf_IOK|SVf_NOK))) {
+		if (!SvPOK(key) || !looks_like_number(key))
+		    goto done;
+		if (integer)
+		    (void)SvIV_nomg(key);
+		else if (!SvIV_please_nomg(key))
+		    (void)SvNV_nomg(key);
+	    }
+	    if (SvNOK(key) && Perl_isnan(SvNVX(key)))
+		goto done;
+	    if (integer || SvIOK(key)) {
+		if (!integer && SvIsUV(key))
+		    goto done;
+		if (SvIOK(key)) {
+		    const IV iv = SvIVX(key);
+		    if (iv > ((IV)1 << NV_PRESERVES_UV_BITS)
+			|| iv < -((IV)1 << NV_PRESERVES_UV_BITS))
+			big_iv = TRUE;
+		}
+	    }
+	    else if (SvNOK(key))
+		all_iv = FALSE;
+	    else
+		goto done;
+	}
+#ifndef PERL_PRESERVE_IVUV
+	if (!integer)
+	    all_iv = big_iv = FALSE;	/* ncmp always compares NVs */
+#endif
+#ifndef RADIXSORT_NV
+	if (!integer && !all_iv)
+	    goto done;
+#endif
+	if (!integer && !all_iv && big_iv)
+	    goto done;
+
+	Newx(list, 2 * nmemb, radix_num);
+	for (i = 0; i < nmemb; i++) {
+	    SV * const key = keys[i];
+	    UV k;
+	    if (integer)
+		k = RADIX_IV_KEY(SvIV_nomg(key));
+	    else if (all_iv)
+		k = RADIX_IV_KEY(SvIVX(key));
+#ifdef RADIXSORT_NV
+	    else
+		k = S_radix_nv_key(SvNOK(key) ? SvNVX(key) : (NV)SvIVX(key));
+#endif
+	    list[i].key = (flags & SORTf_DESC) ? ~k : k;
+	    list[i].sv = array[i];
+	}
+	{
+	    const radix_num * const result = S_radixsort_num_list(list, nmemb);
+	    for (i = 0; i < nmemb; i++)
+		array[i] = result[i].sv;
+	}
+	Safefree(list);
+	sorted = TRUE;
+    }
+
+  done:
+    return sorted;
+}
+
+/* Top-k sorting, for (sort ...)[LIST] where rpeep has checked that the
+ * slice indices are all non-negative integer constants and set
+ * OPpSORT_TOPK.  Only as many elements as the biggest index needs are
+ * sorted: S_sortsv_select() picks out the ones a full stable sort would
+ * put first, with a heap holding the best so far, in O(n log k)
+ * comparisons.  Then just those are sorted. */
+
+#ifndef SORT_TOPK_RATIO
+#define SORT_TOPK_RATIO (4)	/* only bother when k is this much smaller */
+#endif
+
+/* How many elements the slice following the sort op needs */
+
+STATIC size_t
+S_sort_topk_count(pTHX_ const OP *lslice)
+{
+    const OP *kid;
+    IV max = 0;
+
+    PERL_UNUSED_CONTEXT;
+
+    if (lslice->op_type != OP_LSLICE)
+	return 0;
+    kid = OpSIBLING(cUNOPx(cBINOPx(lslice)->op_first)->op_first);
+
+    if (kid->op_type == OP_RV2AV) {
+	const AV * const av = MUTABLE_AV(cSVOPx_sv(cUNOPx(kid)->op_first));
+	SSize_t i;
+	for (i = 0; i <= AvFILLp(av); i++)
+	    if (SvIVX(AvARRAY(av)[i]) > max)
+		max = SvIVX(AvARRAY(av)[i]);
+    }
+    else {
+	for (; kid; kid = OpSIBLING(kid))
+	    if (SvIVX(cSVOPx_sv(kid)) > max)
+		max = SvIVX(cSVOPx_sv(kid));
+    }
+    return (size_t)max + 1;
+}
+
+/* Whether array[i] would sort after array[j], equal elements keeping
+ * their order */
+
+STATIC bool
+S_sortsv_after(pTHX_ SV **array, size_t i, size_t j, SVCOMPARE_t cmp,
+	       int sense)
+{
+    const I32 result = cmp(aTHX_ array[i], array[j]) * sense;
+    return result > 0 || (result == 0 && i > j);
+}
+
+STATIC void
+S_sortsv_sift(pTHX_ SV **array, size_t *heap, size_t k, size_t pos,
+	      SVCOMPARE_t cmp, int sense)
+{
+    const size_t top = heap[pos];
+
+    for (;;) {
+	size_t child = 2 * pos + 1;
+	if (child >= k)
+	    break;
+	if (child + 1 < k
+	    && S_sortsv_after(aTHX_ array, heap[child + 1], heap[child],
+			      cmp, sense))
+	    child++;
+	if (!S_sortsv_after(aTHX_ array, heap[child], top, cmp, sense))
+	    break;
+	heap[pos] = heap[child];
+	pos = child;
+    }
+    heap[pos] = top;
+}
+
+/* Move the k elements of array which a stable sort would put first to the
+ * front of it, in their original order.  The heap is ordered with the
+ * last of them at the top, to be replaced by anything which sorts before
+ * it.  The allocations are freed by the caller's LEAVE, as the comparison
+ * may die. */
+
+STATIC void
+S_sortsv_select(pTHX_ SV **array, size_t nmemb, size_t k, SVCOMPARE_t cmp,
+		U32 flags)
+{
+    const int sense = (flags & SORTf_DESC) ? -1 : 1;
+    size_t *heap;
+    char *keep;
+    size_t i, j;
+
+    Newx(heap, k, size_t);
+    SAVEFREEPV(heap);
+    for (i = 0; i < k; i++)
+	heap[i] = i;
+    for (i = k / 2; i-- > 0; )
+	S_sortsv_sift(aTHX_ array, heap, k, i, cmp, sense);
+    for (i = k; i < nmemb; i++) {
+	if (S_sortsv_after(aTHX_ array, heap[0], i, cmp, sense)) {
+	    heap[0] = i;
+	    S_sortsv_sift(aTHX_ array, heap, k, 0, cmp, sense);
+	}
+    }
+
+    Newxz(keep, nmemb, char);
+    SAVEFREEPV(keep);
+    for (i = 0; i < k; i++)
+	keep[heap[i]] = 1;
+    for (i = j = 0; i < nmemb; i++)
+	if (keep[i])
+	    array[j++] = array[i];
+}
+
 PP(pp_sort)
 {
     dSP; dMARK; dORIGMARK;
@@ -1489,6 +2094,7 @@ PP(pp_sort)
     void (*sortsvp)(pTHX_ SV **array, size_t nmemb, SVCOMPARE_t cmp, U32 flags)
       = Perl_sortsv_flags;
     I32 all_SIVs = 1;
+    size_t topk = 0;
 
     if ((priv & OPpSORT_DESCEND) != 0)
 	sort_flags |= SORTf_DESC;
@@ -1636,9 +2242,22 @@ PP(pp_sort)
     if (sorting_av)
 	AvFILLp(av) = max-1;
 
+    if (max > 1 && (priv & OPpSORT_TOPK)) {
+	topk = S_sort_topk_count(aTHX_ nextop);
+	if (topk > (size_t)max / SORT_TOPK_RATIO)
+	    topk = 0;
+    }
+
     if (max > 1) {
 	SV **start;
-	if (PL_sortcop) {
+	SVCOMPARE_t cmp;
+	if (PL_sortcop && (flags & OPf_SPECIAL) && !topk
+	    && !(sort_flags & SORTf_QSORT)
+	    && S_sortkeyedsv(aTHX_ p1 - max, max, sort_flags))
+	{
+	    start = p1 - max;
+	}
+	else if (PL_sortcop) {
 	    PERL_CONTEXT *cx;
 	    SV** newsp;
 	    const bool oldcatch = CATCH_GET;
@@ -1696,9 +2315,12 @@ PP(pp_sort)
 	    cx->cx_type |= CXp_MULTICALL;
 	    
 	    start = p1 - max;
-	    sortsvp(aTHX_ start, max,
-		    (is_xsub ? S_sortcv_xsub : hasargs ? S_sortcv_stacked : S_sortcv),
-		    sort_flags);
+	    cmp = is_xsub ? S_sortcv_xsub : hasargs ? S_sortcv_stacked : S_sortcv;
+	    if (topk) {
+		S_sortsv_select(aTHX_ start, max, topk, cmp, sort_flags);
+		max = topk;
+	    }
+	    sortsvp(aTHX_ start, max, cmp, sort_flags);
 
 	    if (!(flags & OPf_SPECIAL)) {
 		SV *sv;
@@ -1716,8 +2338,7 @@ PP(pp_sort)
 	else {
 	    MEXTEND(SP, 20);	/* Can't afford stack realloc on signal. */
 	    start = sorting_av ? AvARRAY(av) : ORIGMARK+1;
-	    sortsvp(aTHX_ start, max,
-		    (priv & OPpSORT_NUMERIC)
+	    cmp = (priv & OPpSORT_NUMERIC)
 		        ? ( ( ( priv & OPpSORT_INTEGER) || all_SIVs)
 			    ? ( overloading ? S_amagic_i_ncmp : S_sv_i_ncmp)
 			    : ( overloading ? S_amagic_ncmp : S_sv_ncmp ) )
@@ -1729,8 +2350,14 @@ PP(pp_sort)
 				: (SVCOMPARE_t)sv_cmp_locale_static)
                             :
 #endif
-			      ( overloading ? (SVCOMPARE_t)S_amagic_cmp : (SVCOMPARE_t)sv_cmp_static)),
-		    sort_flags);
+			      ( overloading ? (SVCOMPARE_t)S_amagic_cmp : (SVCOMPARE_t)sv_cmp_static));
+	    if (topk) {
+		S_sortsv_select(aTHX_ start, max, topk, cmp, sort_flags);
+		max = topk;
+	    }
+	    if ((sort_flags & SORTf_QSORT)
+		|| !S_radixsortsv(aTHX_ start, max, cmp, sort_flags))
+		sortsvp(aTHX_ start, max, cmp, sort_flags);
 	}
 	if ((priv & OPpSORT_REVERSE) != 0) {
 	    SV **q = start+max-1;
@@ -6357,6 +6357,12 @@ STATIC void	S_inplace_aassign(pTHX_ OP* o)
 #define PERL_ARGS_ASSERT_INPLACE_AASSIGN	\
 	assert(o)
 
+STATIC bool	S_is_foreach_split(pTHX_ const OP *o)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(pTHX_1);
+#define PERL_ARGS_ASSERT_IS_FOREACH_SPLIT	\
+	assert(o)
+
 STATIC bool	S_is_handle_constructor(const OP *o, I32 numargs)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(1);
@@ -7530,6 +7536,12 @@ STATIC char *	S_F0convert(NV nv, char *const endbuf, STRLEN *const len)
 #define PERL_ARGS_ASSERT_F0CONVERT	\
 	assert(endbuf); assert(len)
 
+STATIC char *	S_Fconvert(NV nv, const STRLEN precis, char *const endbuf, STRLEN *const len)
+			__attribute__nonnull__(3)
+			__attribute__nonnull__(4);
+#define PERL_ARGS_ASSERT_FCONVERT	\
+	assert(endbuf); assert(len)
+
 STATIC void	S_anonymise_cv_maybe(pTHX_ GV *gv, CV *cv)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
@@ -7653,6 +7665,14 @@ STATIC char *	S_uiv_2buf(char *const buf, const IV iv, UV uv, const int is_uv, c
 #define PERL_ARGS_ASSERT_UIV_2BUF	\
 	assert(buf); assert(peob)
 
+STATIC void	S_utf8_mg_index_build(pTHX_ SV *const sv, MAGIC *const mg, const U8 *const start, const U8 *const send)
+			__attribute__nonnull__(pTHX_1)
+			__attribute__nonnull__(pTHX_2)
+			__attribute__nonnull__(pTHX_3)
+			__attribute__nonnull__(pTHX_4);
+#define PERL_ARGS_ASSERT_UTF8_MG_INDEX_BUILD	\
+	assert(sv); assert(mg); assert(start); assert(send)
+
 STATIC void	S_utf8_mg_len_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN ulen)
 			__attribute__nonnull__(pTHX_1)
 			__attribute__nonnull__(pTHX_2);
@@ -7917,6 +7937,13 @@ STATIC UV	S_check_locale_boundary_crossing(pTHX_ const U8* const p, const UV res
 #define PERL_ARGS_ASSERT_CHECK_LOCALE_BOUNDARY_CROSSING	\
 	assert(p); assert(ustrp); assert(lenp)
 
+PERL_STATIC_INLINE const U8 *	S_find_variant_byte(const U8 *s, const U8 * const e)
+			__attribute__warn_unused_result__
+			__attribute__nonnull__(1)
+			__attribute__nonnull__(2);
+#define PERL_ARGS_ASSERT_FIND_VARIANT_BYTE	\
+	assert(s); assert(e)
+
 PERL_STATIC_INLINE bool	S_is_utf8_common(pTHX_ const U8 *const p, SV **swash, const char * const swashname, SV* const invlist)
 			__attribute__warn_unused_result__
 			__attribute__nonnull__(pTHX_1)
@@ -6750,6 +6750,15 @@ Perl_re_op_compile(pTHX_ SV ** const patternp, int pat_count,
 	SAVEFREEPV(pRExC_state->code_blocks);
     }
 
+    /* use re 'budget' => N */
+    {
+        SV * const budget = cop_hints_fetch_pvs(PL_curcop, "re_budget", 0);
+        if (SvOK(budget)) {
+            const UV n = SvUV(budget);
+            ri->budget = n > U32_MAX ? U32_MAX : (U32)n;
+        }
+    }
+
     {
         bool has_p     = ((r->extflags & RXf_PMf_KEEPCOPY) == RXf_PMf_KEEPCOPY);
         bool has_charset = (get_regex_charset(r->extflags)
@@ -17153,6 +17162,7 @@ Perl_regdupe_internal(pTHX_ REGEXP * const rx, CLONE_PARAMS *param)
 	reti->code_blocks = NULL;
 
     reti->regstclass = NULL;
+    reti->budget = ri->budget;
 
     if (ri->data) {
 	struct reg_data *d;
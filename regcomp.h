@@ -111,6 +111,8 @@
                                    a regop is an index into this structure */
 	struct reg_code_block *code_blocks;/* positions of literal (?{}) */
 	int num_code_blocks;	/* size of code_blocks[] */
+	U32 budget;		/* backtracks allowed per match (use re
+                                   'budget'), or 0 for no limit */
 	regnode program[1];	/* Unwarranted chumminess with compiler. */
 } regexp_internal;
 
@@ -2668,6 +2668,7 @@ Perl_regexec_flags(pTHX_ REGEXP * const rx, char *stringarg, char *strend,
     reginfo->strbeg  = strbeg;
     reginfo->sv = sv;
     reginfo->poscache_maxiter = 0; /* not yet started a countdown */
+    reginfo->budget_left = progi->budget;
     reginfo->strend = strend;
     /* see how far we have to get to not match where we matched before */
     reginfo->till = stringarg + minend;
@@ -7135,6 +7136,22 @@ NULL
     }    
     if (depth) {
 	/* there's a previous state to backtrack to */
+        if (rexi->budget) {
+            /* Under use re 'budget', each backtrack uses up one unit.  Once
+             * they are all gone, fail the whole match, not just this
+             * starting position, in the same way as (*COMMIT) does */
+            if (!reginfo->budget_left) {
+                if (!reginfo->warned && ckWARN(WARN_REGEXP)) {
+                    reginfo->warned = TRUE;
+                    Perl_warner(aTHX_ packWARN(WARN_REGEXP),
+                        "Regular expression backtracking budget (%"UVuf") "
+                        "exhausted", (UV)rexi->budget);
+                }
+                reginfo->cutpoint = reginfo->strend;
+                goto final_exit;
+            }
+            reginfo->budget_left--;
+        }
 	st--;
 	if (st < SLAB_FIRST(PL_regmatch_slab)) {
 	    PL_regmatch_slab = PL_regmatch_slab->prev;
@@ -7252,8 +7269,10 @@ S_regrepeat(pTHX_ regexp *prog, char **startposp, const regnode *p,
 		hardcount++;
 	    }
 	} else {
-	    while (scan < loceol && *scan != '\n')
-		scan++;
+            /* Each byte is a character, so let memchr() find the end of the
+             * run; <loceol> has already been limited to <max> */
+	    char * const nl = (char *) memchr(scan, '\n', loceol - scan);
+	    scan = (nl) ? nl : loceol;
 	}
 	break;
     case SANY:
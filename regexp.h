@@ -647,10 +647,12 @@ typedef struct {
     I32  poscache_maxiter; /* how many whilems todo before S-L cache kicks in */
     I32  poscache_iter;    /* current countdown from _maxiter to zero */
     STRLEN poscache_size;  /* size of regmatch_info_aux.poscache */
+    U32  budget_left;      /* backtracks left before giving up (re 'budget') */
     bool intuit;    /* re_intuit_start() is the top-level caller */
     bool is_utf8_pat;    /* regex is utf8 */
     bool is_utf8_target; /* string being matched is utf8 */
-    bool warned; /* we have issued a recursion warning; no need for more */
+    bool warned; /* we have issued a recursion or budget warning; no need
+                    for more */
 } regmatch_info;
  
 
@@ -1361,11 +1361,21 @@ Perl_cx_dump(pTHX_ PERL_CONTEXT *cx)
 		(long)cx->blk_loop.resetsp);
 	PerlIO_printf(Perl_debug_log, "BLK_LOOP.MY_OP = 0x%"UVxf"\n",
 		PTR2UV(cx->blk_loop.my_op));
-	/* XXX: not accurate for LAZYSV/IV */
-	PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERARY = 0x%"UVxf"\n",
-		PTR2UV(cx->blk_loop.state_u.ary.ary));
-	PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERIX = %ld\n",
-		(long)cx->blk_loop.state_u.ary.ix);
+	if (CxTYPE(cx) == CXt_LOOP_FOR && cx->cx_type & CXp_FOR_SPLIT) {
+	    PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERSTR = 0x%"UVxf"\n",
+		    PTR2UV(cx->blk_loop.state_u.lazysplit.str));
+	    PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITEROFF = %lu\n",
+		    (unsigned long)cx->blk_loop.state_u.lazysplit.off);
+	    PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERSEP = 0x%02x\n",
+		    (unsigned)(U8)cx->blk_loop.state_u.lazysplit.sep);
+	}
+	else {
+	    /* XXX: not accurate for LAZYSV/IV */
+	    PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERARY = 0x%"UVxf"\n",
+		    PTR2UV(cx->blk_loop.state_u.ary.ary));
+	    PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERIX = %ld\n",
+		    (long)cx->blk_loop.state_u.ary.ix);
+	}
 	PerlIO_printf(Perl_debug_log, "BLK_LOOP.ITERVAR = 0x%"UVxf"\n",
 		PTR2UV(CxITERVAR(cx)));
 	break;
@@ -125,6 +125,13 @@
 #   define ASSERT_UTF8_CACHE(cache) NOOP
 #endif
 
+/* The sampled index, if there is one, follows the cache pairs in the
+ * PERL_MAGIC_utf8 mg_ptr: first the number of entries, then the entries,
+ * entry k (counting from 0) being the byte offset of character
+ * (k + 1) * PERL_UTF8_INDEX_STRIDE */
+#define UTF8_INDEX_COUNT(cache)	((cache)[PERL_MAGIC_UTF8_CACHESIZE * 2])
+#define UTF8_INDEX(cache)	((cache) + PERL_MAGIC_UTF8_CACHESIZE * 2 + 1)
+
 #ifdef PERL_OLD_COPY_ON_WRITE
 #define SV_COW_NEXT_SV(sv)	INT2PTR(SV *,SvUVX(sv))
 #define SV_COW_NEXT_SV_SET(current,next)	SvUV_set(current, PTR2UV(next))
@@ -2930,6 +2937,92 @@ S_infnan_2pv(NV nv, char* buffer, size_t maxlen, char plus) {
     }
 }
 
+/* Helper for sv_2pv_flags.  Writes a finite, non-zero NV to the buffer
+ * the way "%.15g" would when that needs no exponent, which covers
+ * integers below 1e15 and other values from 1e-4 up.  It works from the
+ * value scaled to a 15 digit integer.  The scaling multiplication is the
+ * only inexact step, so if the scaled value is within its rounding error
+ * of a half, this returns zero to leave the rounding to the C library.
+ * The buffer needs room for 22 bytes.  On success returns the written
+ * length, excluding the zero byte.  Only compiled for plain doubles. */
+STATIC size_t
+S_nv_2pv_fixed(NV nv, char *buffer)
+{
+#if NVSIZE == 8 && NV_DIG == 15 && UVSIZE == 8 && !defined(USE_LONG_DOUBLE)
+    static const NV scale[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+	1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+    static const NV bound[] = {
+	1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5,
+	1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14
+    };
+    char digits[15];
+    char *p = buffer;
+    const NV anv = nv < 0 ? -nv : nv;
+    NV scaled, half;
+    UV uv;
+    int e, i, last;
+
+    if (nv < 0)
+	*p++ = '-';
+
+    if (anv < 1e15 && anv == (NV)(UV)anv) {
+	char *q;
+	uv = (UV)anv;
+	i = 0;
+	do {
+	    digits[i++] = '0' + (char)(uv % 10);
+	} while (uv /= 10);
+	for (q = p + i; i; )
+	    *p++ = digits[--i];
+	*q = '\0';
+	return q - buffer;
+    }
+
+    /* also rules out NaNs */
+    if (!(anv >= 1e-4 && anv < 1e15))
+	return 0;
+    for (e = 14; anv < bound[e + 4]; e--)
+	;
+    scaled = anv * scale[14 - e];
+    uv = (UV)scaled;
+    half = scaled - (NV)uv - 0.5;
+    if ((half < 0 ? -half : half) <= scaled * (NV_EPSILON / 2))
+	return 0;
+    if (half > 0)
+	uv++;
+    if (uv < (UV)1e14 || uv >= (UV)1e15)
+	return 0;	/* the value was right at a power of ten */
+
+    for (i = 15; i--; uv /= 10)
+	digits[i] = '0' + (char)(uv % 10);
+    for (last = 14; digits[last] == '0'; last--)
+	;
+    if (e >= 0) {
+	for (i = 0; i <= e; i++)
+	    *p++ = digits[i];
+	if (last > e)
+	    *p++ = '.';
+    }
+    else {
+	*p++ = '0';
+	*p++ = '.';
+	for (i = e + 1; i < 0; i++)
+	    *p++ = '0';
+	i = 0;
+    }
+    for (; i <= last; i++)
+	*p++ = digits[i];
+    *p = '\0';
+    return p - buffer;
+#else
+    PERL_UNUSED_ARG(nv);
+    PERL_UNUSED_ARG(buffer);
+    return 0;
+#endif
+}
+
 /*
 =for apidoc sv_2pv_flags
 
@@ -3126,6 +3219,15 @@ Perl_sv_2pv_flags(pTHX_ SV *const sv, STRLEN *const lp, const I32 flags)
                 s += len;
                 SvPOK_on(sv);
             }
+            else if (!IN_LC(LC_NUMERIC)
+                     && (len = S_nv_2pv_fixed(SvNVX(sv),
+                                              SvGROW_mutable(sv, 22))) > 0)
+            {
+                s = SvPVX_mutable(sv) + len;
+#ifndef USE_LOCALE_NUMERIC
+                SvPOK_on(sv);
+#endif
+            }
             else {
                 /* some Xenix systems wipe out errno here */
                 dSAVE_ERRNO;
@@ -7250,6 +7352,32 @@ S_sv_pos_u2b_cached(pTHX_ SV *const sv, MAGIC **const mgp, const U8 *const start
 		return cache[3];
 	    }
 
+	    if (!UTF8_INDEX_COUNT(cache)
+		&& (STRLEN)(send - start) >= PERL_UTF8_INDEX_MIN)
+	    {
+		/* If this is a long way past anywhere we know about, random
+		   access is likely, so index the whole string.  */
+		STRLEN nearest = uoffset0;
+		if (cache[2] < uoffset && cache[2] > nearest)
+		    nearest = cache[2];
+		if (cache[0] < uoffset && cache[0] > nearest)
+		    nearest = cache[0];
+		if (uoffset - nearest > PERL_UTF8_INDEX_STRIDE) {
+		    utf8_mg_index_build(sv, *mgp, start, send);
+		    cache = (STRLEN *) (*mgp)->mg_ptr;
+		}
+	    }
+	    if (UTF8_INDEX_COUNT(cache)) {
+		/* Start from the closest sample at or before uoffset.  */
+		STRLEN k = uoffset / PERL_UTF8_INDEX_STRIDE;
+		if (k > UTF8_INDEX_COUNT(cache))
+		    k = UTF8_INDEX_COUNT(cache);
+		if (k && k * PERL_UTF8_INDEX_STRIDE > uoffset0) {
+		    uoffset0 = k * PERL_UTF8_INDEX_STRIDE;
+		    boffset0 = UTF8_INDEX(cache)[k - 1];
+		}
+	    }
+
 	    if (cache[0] < uoffset) {
 		/* The cache already knows part of the way.   */
 		if (cache[0] > uoffset0) {
@@ -7456,6 +7584,8 @@ S_utf8_mg_len_cache_update(pTHX_ SV *const sv, MAGIC **const mgp,
    1: corresponding byte offset
    2: smaller UTF-8 offset
    3: corresponding byte offset
+   followed by the count of entries in the sampled index built by
+   S_utf8_mg_index_build(), which is 0 until it is built, and the entries.
 
    Unused cache pairs have the value 0, 0.
    Keeping the cache "backwards" means that the invariant of
@@ -7485,7 +7615,7 @@ S_utf8_mg_pos_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN b
     assert(*mgp);
 
     if (!(cache = (STRLEN *)(*mgp)->mg_ptr)) {
-	Newxz(cache, PERL_MAGIC_UTF8_CACHESIZE * 2, STRLEN);
+	Newxz(cache, PERL_MAGIC_UTF8_CACHESIZE * 2 + 1, STRLEN);
 	(*mgp)->mg_ptr = (char *) cache;
     }
     assert(cache);
@@ -7582,6 +7712,57 @@ S_utf8_mg_pos_cache_update(pTHX_ SV *const sv, MAGIC **const mgp, const STRLEN b
     ASSERT_UTF8_CACHE(cache);
 }
 
+/* Walk the whole string once, extending the UTF-8 offset cache of a long
+   string with the byte offset of every PERL_UTF8_INDEX_STRIDE'th character,
+   so that character offset lookups anywhere in it have at most that many
+   characters left to walk.  The index lives in the same buffer as the cache
+   pairs, so anything that clears the cache discards it too.  As the walk
+   reaches the end of the string, the character length is cached as well.  */
+static void
+S_utf8_mg_index_build(pTHX_ SV *const sv, MAGIC *const mg,
+		      const U8 *const start, const U8 *const send)
+{
+    /* No character is shorter than a byte, so this is an upper bound */
+    const STRLEN max = (send - start) / PERL_UTF8_INDEX_STRIDE;
+    STRLEN *cache = (STRLEN *) mg->mg_ptr;
+    STRLEN *entry;
+    STRLEN count = 0;
+    STRLEN ulen = 0;
+    const U8 *s = start;
+
+    PERL_ARGS_ASSERT_UTF8_MG_INDEX_BUILD;
+    PERL_UNUSED_ARG(sv);
+
+    Renew(cache, PERL_MAGIC_UTF8_CACHESIZE * 2 + 1 + max, STRLEN);
+    entry = UTF8_INDEX(cache);
+
+    while (s < send) {
+	STRLEN i = PERL_UTF8_INDEX_STRIDE;
+	while (i && s < send) {
+	    s += UTF8SKIP(s);
+	    i--;
+	}
+	ulen += PERL_UTF8_INDEX_STRIDE - i;
+	if (i || s >= send)
+	    break;
+	entry[count++] = s - start;
+    }
+    assert(count <= max);
+
+    if (count < max)
+	Renew(cache, PERL_MAGIC_UTF8_CACHESIZE * 2 + 1 + count, STRLEN);
+    UTF8_INDEX_COUNT(cache) = count;
+    mg->mg_ptr = (char *) cache;
+
+    if (s == send) {
+	if (PL_utf8cache < 0) {
+	    const STRLEN real = utf8_length(start, send);
+	    assert_uft8_cache_coherent("utf8_mg_index_build", ulen, real, sv);
+	}
+	mg->mg_len = ulen;
+    }
+}
+
 /* We already know all of the way, now we may be able to walk back.  The same
    assumption is made as in S_sv_pos_u2b_midway(), namely that walking
    backward is half the speed of walking forward. */
@@ -7651,7 +7832,7 @@ Perl_sv_pos_b2u_flags(pTHX_ SV *const sv, STRLEN const offset, U32 flags)
 	&& (mg = mg_find(sv, PERL_MAGIC_utf8)))
     {
 	if (mg->mg_ptr) {
-	    STRLEN * const cache = (STRLEN *) mg->mg_ptr;
+	    STRLEN *cache = (STRLEN *) mg->mg_ptr;
 	    if (cache[1] == offset) {
 		/* An exact match. */
 		return cache[0];
@@ -7661,7 +7842,45 @@ Perl_sv_pos_b2u_flags(pTHX_ SV *const sv, STRLEN const offset, U32 flags)
 		return cache[2];
 	    }
 
-	    if (cache[1] < offset) {
+	    if (!UTF8_INDEX_COUNT(cache)
+		&& blen >= PERL_UTF8_INDEX_MIN
+		&& !SvGMAGICAL(sv) && SvPOK(sv))
+	    {
+		/* As in S_sv_pos_u2b_cached(), measuring the distance in
+		   bytes  */
+		STRLEN nearest = 0;
+		if (cache[3] < offset)
+		    nearest = cache[3];
+		if (cache[1] < offset)
+		    nearest = cache[1];
+		if (offset - nearest > PERL_UTF8_INDEX_STRIDE) {
+		    utf8_mg_index_build(sv, mg, s, s + blen);
+		    cache = (STRLEN *) mg->mg_ptr;
+		}
+	    }
+
+	    if (UTF8_INDEX_COUNT(cache)
+		&& offset - (cache[1] < offset ? cache[1] : 0)
+					> PERL_UTF8_INDEX_STRIDE)
+	    {
+		/* Binary search for the last sample at or before offset, and
+		   count on from there.  */
+		const STRLEN *const entry = UTF8_INDEX(cache);
+		STRLEN lo = 0;
+		STRLEN hi = UTF8_INDEX_COUNT(cache);
+		while (lo < hi) {
+		    const STRLEN mid = (lo + hi) / 2;
+		    if (entry[mid] <= offset)
+			lo = mid + 1;
+		    else
+			hi = mid;
+		}
+		len = lo
+		    ? lo * PERL_UTF8_INDEX_STRIDE
+			+ utf8_length(s + entry[lo - 1], send)
+		    : utf8_length(s, send);
+	    }
+	    else if (cache[1] < offset) {
 		/* We already know part of the way. */
 		if (mg->mg_len != -1) {
 		    /* Actually, we know the end too.  */
@@ -10798,6 +11017,59 @@ S_F0convert(NV nv, char *const endbuf, STRLEN *const len)
     return NULL;
 }
 
+/* Like F0convert, but for "%.<precis>f" with a non-zero precis, and
+ * only for finite values which scaled by 10**precis fit comfortably in a
+ * UV.  The scaling multiplication is the only inexact step, so the result
+ * is correctly rounded unless the scaled value is within its rounding
+ * error of a half, when NULL is returned to leave it (and round-half-even
+ * of exact ties) to the C library.  The caller handles the locale's radix
+ * point by not calling this under "use locale". */
+
+STATIC char *
+S_Fconvert(NV nv, const STRLEN precis, char *const endbuf, STRLEN *const len)
+{
+    static const NV pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+	1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+    };
+    const bool neg = cBOOL(Perl_signbit(nv));
+    NV scaled;
+    NV half;
+    UV uv;
+    char *p = endbuf;
+    STRLEN i;
+
+    PERL_ARGS_ASSERT_FCONVERT;
+
+    if (precis >= C_ARRAY_LENGTH(pow10))
+	return NULL;
+    if (neg)
+	nv = -nv;
+    scaled = nv * pow10[precis];
+    /* also false for a NaN */
+    if (!(scaled < (NV)(UVSIZE >= 8 ? (UV)1 << 52 : UV_MAX / 2)))
+	return NULL;
+    uv = (UV)scaled;
+    half = scaled - (NV)uv - 0.5;
+    if ((half < 0 ? -half : half) <= scaled * NV_EPSILON)
+	return NULL;
+    if (half > 0)
+	uv++;
+
+    for (i = 0; i < precis; i++) {
+	*--p = '0' + (char)(uv % 10);
+	uv /= 10;
+    }
+    *--p = '.';
+    do {
+	*--p = '0' + (char)(uv % 10);
+    } while (uv /= 10);
+    if (neg)
+	*--p = '-';
+    *len = endbuf - p;
+    return p;
+}
+
 
 /*
 =for apidoc sv_vcatpvfn
@@ -11294,10 +11566,15 @@ Perl_sv_vcatpvfn_flags(pTHX_ SV *const sv, const char *const pat, const STRLEN p
                         if (*ebuf)	/* May return an empty string for digits==0 */
                             return;
                     }
-                } else if (!digits) {
+                } else {
                     STRLEN l;
 
-                    if ((p = F0convert(nv, ebuf + sizeof ebuf, &l))) {
+                    if (!digits
+                        ? (p = F0convert(nv, ebuf + sizeof ebuf, &l)) != NULL
+                        : !IN_LC(LC_NUMERIC)
+                          && (p = Fconvert(nv, digits, ebuf + sizeof ebuf,
+                                           &l)) != NULL)
+                    {
                         sv_catpvn_nomg(sv, p, l);
                         return;
                     }
@@ -12266,12 +12543,16 @@ Perl_sv_vcatpvfn_flags(pTHX_ SV *const sv, const char *const pat, const STRLEN p
 		PL_efloatbuf[0] = '\0';
 	    }
 
-	    if ( !(width || left || plus || alt) && fill != '0'
-		 && has_precis && intsize != 'q'	/* Shortcuts */
+	    /* Shortcuts.  Any width is applied below, along with that of
+	     * every other conversion, for the ones which break out here.
+	     * F0convert() gets odd values from 2**52 and the sign of -0.0
+	     * wrong, so it keeps to the unpadded case it always had */
+	    if ( !(plus || alt) && fill != '0'
+		 && has_precis && intsize != 'q'
                  && LIKELY(!Perl_isinfnan((NV)fv)) ) {
 		/* See earlier comment about buggy Gconvert when digits,
 		   aka precis is 0  */
-		if ( c == 'g' && precis ) {
+		if ( c == 'g' && precis && !(width || left) ) {
                     STORE_LC_NUMERIC_SET_TO_NEEDED();
                     SNPRINTF_G(fv, PL_efloatbuf, PL_efloatsize, precis);
 		    /* May return an empty string for digits==0 */
@@ -12279,9 +12560,13 @@ Perl_sv_vcatpvfn_flags(pTHX_ SV *const sv, const char *const pat, const STRLEN p
 			elen = strlen(PL_efloatbuf);
 			goto float_converted;
 		    }
-		} else if ( c == 'f' && !precis ) {
+		} else if ( c == 'f' && !precis && !(width || left) ) {
 		    if ((eptr = F0convert(fv, ebuf + sizeof ebuf, &elen)))
 			break;
+		} else if ( c == 'f' && precis && !IN_LC(LC_NUMERIC) ) {
+		    if ((eptr = Fconvert((NV)fv, precis, ebuf + sizeof ebuf,
+					 &elen)))
+			break;
 		}
 	    }
 
@@ -13109,7 +13394,12 @@ Perl_mg_dup(pTHX_ MAGIC *mg, CLONE_PARAMS *const param)
 			  : sv_dup(nmg->mg_obj, param);
 
 	if (nmg->mg_ptr && nmg->mg_type != PERL_MAGIC_regex_global) {
-	    if (nmg->mg_len > 0) {
+	    if (nmg->mg_type == PERL_MAGIC_utf8) {
+		/* The offset cache isn't mg_len long, and is only a cache,
+		   so don't copy it.  mg_len is still the right length.  */
+		nmg->mg_ptr = NULL;
+	    }
+	    else if (nmg->mg_len > 0) {
 		nmg->mg_ptr	= SAVEPVN(nmg->mg_ptr, nmg->mg_len);
 		if (nmg->mg_type == PERL_MAGIC_overload_table &&
 			AMT_AMAGIC((AMT*)nmg->mg_ptr))
@@ -13897,8 +14187,12 @@ Perl_cx_dup(pTHX_ PERL_CONTEXT *cxs, I32 ix, I32 max, CLONE_PARAMS* param)
 		assert ((void *) &ncx->blk_loop.state_u.ary.ary ==
 			(void *) &ncx->blk_loop.state_u.lazysv.cur);
 	    case CXt_LOOP_FOR:
-		ncx->blk_loop.state_u.ary.ary
-		    = av_dup_inc(ncx->blk_loop.state_u.ary.ary, param);
+		if (ncx->cx_type & CXp_FOR_SPLIT)
+		    ncx->blk_loop.state_u.lazysplit.str
+			= sv_dup_inc(ncx->blk_loop.state_u.lazysplit.str, param);
+		else
+		    ncx->blk_loop.state_u.ary.ary
+			= av_dup_inc(ncx->blk_loop.state_u.ary.ary, param);
 	    case CXt_LOOP_LAZYIV:
 	    case CXt_LOOP_PLAIN:
 		if (CxPADLOOP(ncx)) {
@@ -14722,8 +15016,11 @@ perl_clone_using(PerlInterpreter *proto_perl, UV flags,
     Perl_reentrant_init(aTHX);
 #endif
 
-    /* create SV map for pointer relocation */
+    /* create SV map for pointer relocation, big enough from the start for
+     * the SVs about to be copied */
     PL_ptr_table = ptr_table_new();
+    while (PL_ptr_table->tbl_max < (UV)proto_perl->Isv_count)
+	ptr_table_split(PL_ptr_table);
 
     /* initialize these special pointers as early as possible */
     init_constants();
@@ -1,6 +1,6 @@
 #!./perl
 
-print "1..53\n";
+print "1..58\n";
 
 # First test whether the number stringification works okay.
 # (Testing with == would exercise the IV/NV part, not the PV.)
@@ -209,3 +209,20 @@ print $a eq "16702650"     ? "ok 52\n" : "not ok 52 # $a\n";
 
 $a = 0B1101; "$a";
 print $a eq "13"           ? "ok 53\n" : "not ok 53 # $a\n";
+
+# Floating point values which stringify without an exponent
+
+$a = 1e14; "$a";
+print $a eq "100000000000000" ? "ok 54\n" : "not ok 54 # $a\n";
+
+$a = -123.5; "$a";
+print $a eq "-123.5"       ? "ok 55\n" : "not ok 55 # $a\n";
+
+$a = 0.0625; "$a";
+print $a eq "0.0625"       ? "ok 56\n" : "not ok 56 # $a\n";
+
+$a = 1e-4; "$a";
+print $a eq "0.0001"       ? "ok 57\n" : "not ok 57 # $a\n";
+
+$a = 2**40 + 0.5; "$a";
+print $a eq "1099511627776.5" ? "ok 58\n" : "not ok 58 # $a\n";
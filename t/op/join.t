@@ -6,7 +6,7 @@ BEGIN {
     require './test.pl';
 }
 
-plan tests => 29;
+plan tests => 34;
 
 @x = (1, 2, 3);
 is( join(':',@x), '1:2:3', 'join an array with character');
@@ -128,3 +128,20 @@ package o { use overload q|""| => sub { ${$_[0]}++ } }
 for(1,2) { push @_, \join "x", 1 }
 isnt $_[1], $_[0],
     'join(const, const) still returns a new scalar each time';
+
+{
+  my @list = ("ab", "", "cde", "f");
+  my $j = join "::", @list;
+  is $j, "ab::::cde::f", 'join of plain strings';
+  $j = join "", @list;
+  is $j, "abcdef", 'join of plain strings with an empty separator';
+  $j = "x";
+  $j = join ",", $j, "y", $j;
+  is $j, "x,y,x", 'join with the target among the items';
+  my $sep = "-";
+  $sep = join $sep, "a", $sep, "b";
+  is $sep, "a---b", 'join with the target as the separator';
+  my $n = 42;
+  $j = join ",", "a", $n, "\x{100}";
+  is $j, "a,42,\x{100}", 'join falls back for numbers and utf8 items';
+}
@@ -251,7 +251,7 @@ for my $num_chain (1..$max_chain) {
 }
 
 # Tests that use test.pl start here.
-BEGIN { $::additional_tests = 4 }
+BEGIN { $::additional_tests = 10 }
 
 ok(-0.0 eq "0", 'negative zero stringifies as 0');
 ok(!-0.0, "neg zero is boolean false");
@@ -261,3 +261,22 @@ ok(!$nz, 'previously stringified -0.0 is boolean false');
 $nz = -0.0;
 is sprintf("%+.f", - -$nz), sprintf("%+.f", - -$nz),
   "negation does not coerce negative zeroes";
+
+# Decimal strings which fit in an IEEE double's mantissa are converted
+# with correct rounding
+SKIP: {
+    require Config;
+    skip "NVs are not IEEE doubles", 6
+        unless $Config::Config{nvsize} == 8
+            && $Config::Config{doublekind} =~ /^[34]\z/;
+    for (['-2.97',          'c007c28f5c28f5c3'],
+         ['1.8802',         '3ffe154c985f06f7'],
+         ['2.5909256',      '4004ba373372f413'],
+         ['0.000001234',    '3eb4b3fd5942cd96'],
+         ['1e-22',          '3b5e392010175ee6'],
+         ['123456789.0123', '419d6f34540c985f']) {
+        my ($str, $bits) = @$_;
+        is unpack("H*", pack "d>", 0 + $str), $bits,
+           "'$str' converts to the nearest double";
+    }
+}
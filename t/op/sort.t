@@ -6,7 +6,7 @@ BEGIN {
     set_up_inc('../lib');
 }
 use warnings;
-plan( tests => 183 );
+plan( tests => 209 );
 
 # these shouldn't hang
 {
@@ -1018,3 +1018,119 @@ package deletions {
     @_=sort { delete $deletions::{a}; delete $deletions::{b}; 3 } 1..3;
 }
 pass "no crash when sort block deletes *a and *b";
+
+# Large lists of plain numbers and strings are radix sorted; check against
+# the comparison sort, which a non-trivial sort block forces
+{
+    my @ints = map { ($_ * 7919) % 1001 - 500 } 1..1000;
+    push @ints, ~0 >> 1, -(~0 >> 1) - 1, 0;
+    is "@{[sort { $a <=> $b } @ints]}",
+       "@{[sort { my $r = $a <=> $b; $r } @ints]}", 'large integer sort';
+    is "@{[sort { $b <=> $a } @ints]}",
+       "@{[sort { my $r = $b <=> $a; $r } @ints]}", 'large reversed integer sort';
+    {
+        use integer;
+        is "@{[sort { $a <=> $b } @ints]}",
+           "@{[sort { my $r = $a <=> $b; $r } @ints]}",
+           'large integer sort under use integer';
+    }
+
+    my @nums = (map({ (($_ * 7919) % 1001 - 500) / 7 } 1..1000),
+                9**9**9, -9**9**9, -0.0, 0, 1e300, -1e-300);
+    is "@{[sort { $a <=> $b } @nums]}",
+       "@{[sort { my $r = $a <=> $b; $r } @nums]}", 'large numeric sort';
+    is "@{[sort { $b <=> $a } @nums]}",
+       "@{[sort { my $r = $b <=> $a; $r } @nums]}", 'large reversed numeric sort';
+
+    # equal numbers which stringify differently show the sort is stable
+    my @same = map { my $n = ($_ * 13) % 10; ($n, "$n.0", "0$n") } 1..100;
+    { no warnings; my $t = 0; $t += $_ for @same }
+    is "@{[sort { $a <=> $b } @same]}",
+       "@{[sort { my $r = $a <=> $b; $r } @same]}", 'large numeric sort is stable';
+
+    my @strs = map { substr("abcab\0c" x 3, ($_ * 7) % 11, ($_ * 13) % 9) } 1..1000;
+    push @strs, "\xff", "a" x 100, "a" x 99;
+    is "@{[sort @strs]}",
+       "@{[sort { my $r = $a cmp $b; $r } @strs]}", 'large string sort';
+    my @utf8 = map { "\x{100}$_" } @strs;
+    is "@{[sort @utf8]}",
+       "@{[sort { my $r = $a cmp $b; $r } @utf8]}", 'large utf8 string sort';
+    my @mixed = (@strs, @utf8);
+    is "@{[sort @mixed]}",
+       "@{[sort { my $r = $a cmp $b; $r } @mixed]}",
+       'large sort of mixed utf8 and byte strings';
+}
+
+# Blocks comparing one element of $a and $b sort on keys fetched once
+{
+    my @recs = map { { n => ($_ * 7) % 13 - 6, f => (($_ * 11) % 17) / 4,
+                       s => substr("bcabca", $_ % 5, $_ % 3), id => $_ } } 1..200;
+    my @rows = map { [ $_->{s}, $_->{n}, $_->{id} ] } @recs;
+    my $ids = sub { join " ", map { ref eq 'HASH' ? $_->{id} : $_->[2] } @_ };
+
+    is $ids->(sort { $a->{n} <=> $b->{n} } @recs),
+       $ids->(sort { my $r = $a->{n} <=> $b->{n}; $r } @recs),
+       'keyed numeric sort on a hash element';
+    is $ids->(sort { $b->{n} <=> $a->{n} } @recs),
+       $ids->(sort { my $r = $b->{n} <=> $a->{n}; $r } @recs),
+       'reversed keyed numeric sort on a hash element';
+    is $ids->(sort { $a->{f} <=> $b->{f} } @recs),
+       $ids->(sort { my $r = $a->{f} <=> $b->{f}; $r } @recs),
+       'keyed sort on fractional numbers';
+    is $ids->(sort { $a->{s} cmp $b->{s} } @recs),
+       $ids->(sort { my $r = $a->{s} cmp $b->{s}; $r } @recs),
+       'keyed string sort on a hash element';
+    is $ids->(sort { $b->{s} cmp $a->{s} } @recs),
+       $ids->(sort { my $r = $b->{s} cmp $a->{s}; $r } @recs),
+       'reversed keyed string sort on a hash element';
+    is $ids->(sort { $a->[1] <=> $b->[1] } @rows),
+       $ids->(sort { my $r = $a->[1] <=> $b->[1]; $r } @rows),
+       'keyed numeric sort on an array element';
+    is $ids->(sort { $a->[-3] cmp $b->[-3] } @rows),
+       $ids->(sort { my $r = $a->[0] cmp $b->[0]; $r } @rows),
+       'keyed string sort on a negative array index';
+    {
+        use integer;
+        is $ids->(sort { $a->{f} <=> $b->{f} } @recs),
+           $ids->(sort { my $r = $a->{f} <=> $b->{f}; $r } @recs),
+           'keyed sort under use integer';
+    }
+    my @strnums = map { { %$_, n => "$_->{n}" } } @recs;
+    is $ids->(sort { $a->{n} <=> $b->{n} } @strnums),
+       $ids->(sort { my $r = $a->{n} <=> $b->{n}; $r } @strnums),
+       'keyed numeric sort on strings';
+
+    my @w;
+    local $SIG{__WARN__} = sub { push @w, @_ };
+    my @holes = ({ n => 2 }, {}, { n => 1 });
+    () = sort { $a->{n} <=> $b->{n} } @holes;
+    ok scalar(@w), 'keyed sort with missing keys still warns';
+}
+
+# Big enough for the radix sort to switch to wider digits
+{
+    my @nums = map { ((($_ * 104729) % 70001) - 35000) / 3 } 1..70_000;
+    is "@{[sort { $a <=> $b } @nums]}",
+       "@{[sort { my $r = $a <=> $b; $r } @nums]}", 'very large numeric sort';
+}
+
+# (sort ...)[0..N] only fully sorts the elements it returns
+{
+    my @nums = map { ($_ * 7919) % 1000 } 1..1000;
+    my @recs = map { { k => $_ % 17, id => $_ } } 1..1000;
+    my @sorted = sort { $a <=> $b } @nums;
+    is "@{[(sort { $a <=> $b } @nums)[0..9]]}", "@sorted[0..9]",
+       'top-k numeric slice';
+    is "@{[(sort { $b <=> $a } @nums)[0..4]]}",
+       "@{[(reverse @sorted)[0..4]]}", 'top-k descending slice';
+    @sorted = sort @nums;
+    is "@{[(sort @nums)[5,0,2]]}", "@sorted[5,0,2]",
+       'top-k string slice, indices out of order';
+    my @want = map $_->{id}, sort { my $r = $a->{k} <=> $b->{k}; $r } @recs;
+    is "@{[map $_->{id}, (sort { $a->{k} <=> $b->{k} } @recs)[0..19]]}",
+       "@want[0..19]", 'top-k slice keeps the sort stable';
+    is scalar(() = (sort { $a <=> $b } 1..100)[0, 500]), 2,
+       'top-k slice with an index past the end';
+    ok !eval { () = (sort { die "boom\n" } 1..1000)[0..2]; 1 }
+       && $@ eq "boom\n", 'top-k slice propagates die from the sort block';
+}
@@ -6,7 +6,7 @@ BEGIN {
     set_up_inc('../lib');
 }
 
-plan tests => 131;
+plan tests => 145;
 
 $FS = ':';
 
@@ -530,3 +530,61 @@ is "@a", '1 2 3', 'assignment to split-to-array (pmtarget/package array)';
 }
 (@{\@a} = split //, "abc") = 1..10;
 is "@a", '1 2 3', 'assignment to split-to-array (stacked)';
+
+{
+    my @a = split /\t/, "a\tbc\t\td\t\t";
+    is "@a", "a bc  d", 'split on a single byte drops trailing empty fields';
+    @a = split /\t/, "a\tbc\t\td\t\t", -1;
+    is scalar(@a), 6, 'split on a single byte keeps them with a limit of -1';
+    @a = split /:/, "a:b:c:d", 3;
+    is "@a", "a b c:d", 'split on a single byte with a limit';
+    is scalar(() = split /:/, "no colons here"), 1,
+       'split on a single byte not in the string';
+}
+
+{
+    # foreach cuts the fields of a split on a single byte out one at a time
+    my @got;
+    push @got, "[$_]" for split /,/, ",a,,b,,";
+    is "@got", "[] [a] [] [b]", 'foreach over split: empty fields';
+    @got = ();
+    push @got, $_ for split /,/, ",,,";
+    is scalar(@got), 0, 'foreach over split: only separators';
+    @got = ();
+    for my $f (split /,/, "") { push @got, $f }
+    is scalar(@got), 0, 'foreach over split: empty string';
+
+    my $s = "a,b,c";
+    @got = ();
+    for (split /,/, $s) { $s = "x,y"; push @got, $_ }
+    is "@got", "a b c", 'foreach over split: changing the string in the loop';
+
+    @got = ();
+    for (split /,/, "1,2,3,4,5") {
+        next if $_ == 2;
+        last if $_ == 4;
+        push @got, $_;
+    }
+    is "@got", "1 3", 'foreach over split: next and last';
+
+    my @subs;
+    for my $f (split /,/, "p,q,r") { push @subs, sub { $f } }
+    is join("", map $_->(), @subs), "pqr", 'foreach over split: closures';
+    my @refs;
+    for (split /,/, "p,q,r") { push @refs, \$_ }
+    is join("", map $$_, @refs), "pqr", 'foreach over split: references';
+
+    @got = ();
+    for (split /,/, "1,2") { $_ .= "!"; push @got, $_ }
+    is "@got", "1! 2!", 'foreach over split: modifying the loop variable';
+
+    @got = ();
+    for (split /,/, "\x{100},\x{101}b") { push @got, length, utf8::is_utf8($_) }
+    is "@got", "1 1 2 1", 'foreach over split: utf8 string';
+
+    @got = ();
+    for my $x (split /,/, "a,b") {
+        for my $y (split /;/, "1;2") { push @got, "$x$y" }
+    }
+    is "@got", "a1 a2 b1 b2", 'foreach over split: nested loops';
+}
@@ -243,7 +243,7 @@ if ($Config{nvsize} == 8 &&
     print "# no hexfloat tests\n";
 }
 
-plan tests => 1408 + ($Q ? 0 : 12) + @hexfloat;
+plan tests => 1421 + ($Q ? 0 : 12) + @hexfloat;
 
 use strict;
 use Config;
@@ -648,3 +648,28 @@ for my $t (@hexfloat) {
     }
     ok($ok, "'$format' '$arg' -> '$result' cf '$expected'");
 }
+
+# "%.Nf" is mostly converted without the C library; check the cases that
+# must still round correctly, and widths applied to the result
+is(sprintf("%.2f", 2.675), "2.67", "%.2f of a value just below a half");
+is(sprintf("%.2f", 1.005), "1.00", "%.2f of another value below a half");
+is(sprintf("%.2f", 0.125), "0.12", "%.2f of an exact tie rounds to even");
+is(sprintf("%.3f", -0.0001), "-0.000", "%.3f of a small negative number");
+is(sprintf("%.1f", -0.0), "-0.0", "%.1f of negative zero");
+is(sprintf("%.6f", 1234567.891), "1234567.891000", "%.6f pads with zeros");
+is(sprintf("%.2f", 1e20), "100000000000000000000.00", "%.2f of a big number");
+is(sprintf("%8.2f|%-8.2f|", 3.14159, -3.14159), "    3.14|-3.14   |",
+   "%.2f with a width");
+is(sprintf("%08.2f", -3.14159), "-0003.14", "%.2f with zero fill");
+is(sprintf("%6.0f|%-6.0f|", 2.5, -3.5), "     2|-4    |",
+   "%.0f with a width");
+
+# padded "%.0f" is left to the C library, which rounds big odd values and
+# keeps the sign of -0.0
+SKIP: {
+    skip "no 53-bit doubles", 1 unless $Config{nvsize} == 8;
+    is(sprintf("%20.0f", 4674270162643281), "    4674270162643281",
+       "%20.0f of an odd value between 2**52 and 2**53");
+}
+is(sprintf("%5.0f", -0.0), "   -0", "%5.0f of negative zero");
+is(sprintf("%-5.0f|", -0.0), "-0   |", "%-5.0f of negative zero");
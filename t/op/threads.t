@@ -9,7 +9,7 @@ BEGIN {
      skip_all_without_config('useithreads');
      skip_all_if_miniperl("no dynamic loading on miniperl, no threads");
 
-     plan(27);
+     plan(28);
 }
 
 use strict;
@@ -399,4 +399,14 @@ fresh_perl_is(
   'no crash when deleting $::{INC} in thread'
 );
 
+# The string a foreach over a split cuts its fields from is cloned along
+# with the loop
+{
+  my @got;
+  for my $field (split /,/, "a,b,c") {
+    push @got, threads->create(sub { $field })->join;
+  }
+  is "@got", "a b c", 'thread started in a foreach over a split';
+}
+
 # EOF
@@ -9,7 +9,7 @@ BEGIN {
 
 use strict;
 
-plan(tests => 16);
+plan(tests => 20);
 
 SKIP: {
 skip_without_dynamic_extension("Devel::Peek", 2);
@@ -160,3 +160,23 @@ $ref = bless [], "αabcd_";
 () = length $ref;
 bless $ref, "α";
 is length $ref, length "$ref", 'no utf8 length cache on references';
+
+# Long strings get an index of character offsets
+{
+    no utf8;
+    my @c = map { $_ % 3 ? "a" : chr(0x100 + $_ % 0x700) } 0..99_999;
+    my $long = join "", @c;
+    my $bad = 0;
+    for (my $i = 0; $i < 100_000; $i += 7919) {
+        my $j = ($i * 13) % 100_000;
+        $bad++ unless substr($long, $j, 1) eq $c[$j];
+    }
+    is $bad, 0, 'substr at scattered offsets in a long utf8 string';
+    is length $long, 100_000, 'length of a long utf8 string after indexing';
+    $long =~ /\x{3ff}/g;
+    is pos $long, 1 + (grep { $c[$_] eq "\x{3ff}" } 0..99_999)[0],
+       'pos in a long utf8 string after indexing';
+    substr($long, 50_000, 1) = "\x{100}\x{101}";
+    is substr($long, 99_999, 2), $c[99_998] . $c[99_999],
+       'substr after modifying a long indexed utf8 string';
+}
@@ -45,8 +45,9 @@ for my $token (sort keys %benchmarks) {
 # check that each bit of code compiles and runs
 
 for my $token (sort keys %benchmarks) {
-    my $b = $benchmarks{$token};
-    my $code = "package $token; $b->{setup}; for (1..1) { $b->{code} } 1;";
+    # not $b, which would hide the sort variable from the code
+    my $bm = $benchmarks{$token};
+    my $code = "package $token; $bm->{setup}; for (1..1) { $bm->{code} } 1;";
     no warnings;
     no strict;
     ok(eval $code, "running $token")
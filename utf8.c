@@ -37,6 +37,44 @@
 static const char unees[] =
     "Malformed UTF-8 character (unexpected end of string)";
 
+/* Returns a pointer to the first byte in [s, e) that is not UTF-8 invariant,
+ * or e if they all are.  Long runs of invariants are the common case in
+ * real-world text, so on ASCII platforms, where a byte is invariant just when
+ * its high bit is clear, they are skipped a whole word at a time */
+
+PERL_STATIC_INLINE const U8 *
+S_find_variant_byte(const U8 *s, const U8 * const e)
+{
+    PERL_ARGS_ASSERT_FIND_VARIANT_BYTE;
+
+#ifndef EBCDIC
+    if ((STRLEN) (e - s) >= 2 * sizeof(UV)) {
+        /* mask with the high bit of each byte in a UV set */
+        const UV variants_mask = (~(UV) 0 / 0xFF) * 0x80;
+
+        /* Get to a word boundary a byte at a time */
+        while (PTR2nat(s) & (sizeof(UV) - 1)) {
+            if (! UTF8_IS_INVARIANT(*s))
+                return s;
+            s++;
+        }
+
+        while (s + sizeof(UV) <= e) {
+            if (*(const UV *) s & variants_mask)
+                break;
+            s += sizeof(UV);
+        }
+    }
+#endif
+
+    for (; s < e; s++) {
+        if (! UTF8_IS_INVARIANT(*s))
+            return s;
+    }
+
+    return e;
+}
+
 /*
 =head1 Unicode Support
 These are various utility functions for manipulating UTF8-encoded
@@ -72,16 +110,10 @@ bool
 Perl_is_invariant_string(const U8 *s, STRLEN len)
 {
     const U8* const send = s + (len ? len : strlen((const char *)s));
-    const U8* x = s;
 
     PERL_ARGS_ASSERT_IS_INVARIANT_STRING;
 
-    for (; x < send; ++x) {
-	if (!UTF8_IS_INVARIANT(*x))
-	    break;
-    }
-
-    return x == send;
+    return find_variant_byte(s, send) == send;
 }
 
 /*
@@ -340,7 +372,7 @@ Perl_is_utf8_string(const U8 *s, STRLEN len)
 
     PERL_ARGS_ASSERT_IS_UTF8_STRING;
 
-    while (x < send) {
+    while ((x = find_variant_byte(x, send)) < send) {
         STRLEN len = isUTF8_CHAR(x, send);
         if (UNLIKELY(! len)) {
             return FALSE;
@@ -384,7 +416,16 @@ Perl_is_utf8_string_loclen(const U8 *s, STRLEN len, const U8 **ep, STRLEN *el)
     PERL_ARGS_ASSERT_IS_UTF8_STRING_LOCLEN;
 
     while (x < send) {
-        STRLEN len = isUTF8_CHAR(x, send);
+        STRLEN len;
+
+        /* Each invariant byte is a character on its own */
+        const U8 * const v = find_variant_byte(x, send);
+        outlen += v - x;
+        x = v;
+        if (x >= send)
+            break;
+
+        len = isUTF8_CHAR(x, send);
         if (UNLIKELY(! len)) {
             goto out;
         }
@@ -953,6 +994,13 @@ Perl_utf8_length(pTHX_ const U8 *s, const U8 *e)
     if (e < s)
 	goto warn_and_return;
     while (s < e) {
+        /* Count any run of invariants in bulk */
+        const U8 * const v = find_variant_byte(s, e);
+        len += v - s;
+        s = v;
+        if (s >= e)
+            break;
+
         s += UTF8SKIP(s);
 	len++;
     }
@@ -1235,6 +1283,16 @@ Perl_bytes_to_utf8(pTHX_ const U8 *s, STRLEN *len)
     dst = d;
 
     while (s < send) {
+        /* Invariants are copied as-is, so do a run of them in one go */
+        const U8 * const v = find_variant_byte(s, send);
+        if (v > s) {
+            Copy(s, d, v - s, U8);
+            d += v - s;
+            s = v;
+            if (s >= send)
+                break;
+        }
+
         append_utf8_from_native_byte(*s, &d);
         s++;
     }